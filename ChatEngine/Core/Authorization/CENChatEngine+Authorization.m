@@ -152,8 +152,19 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)handshakeChatAccess:(CENChat *)chat withCompletion:(dispatch_block_t)block {
+    
+    [self handshakeChatAccess:chat withCompletion:block failure:nil];
+}
+
+- (void)handshakeChatAccess:(CENChat *)chat
+             withCompletion:(dispatch_block_t)block
+                    failure:(dispatch_block_t)failure {
 
     if (!self.pubnub) {
+        if (failure) {
+            failure();
+        }
+        
         [self throwPubNubNotReadyConnectToChat:chat];
         return;
     }
@@ -164,6 +175,10 @@ NS_ASSUME_NONNULL_END
         @{ @"route": @"join", @"method": @"post", @"body": @{ @"chat": chatRepresentation } },
     ];
     void (^errorHandlerBlock)(NSArray *) = ^(NSArray *responses) {
+        if (failure) {
+            failure();
+        }
+        
         [self throwPubNubFunctionHandshakeError:responses forChat:chat];
     };
     void (^handleMetaFetch)(BOOL, NSArray *) = ^(BOOL success, NSArray *responses) {
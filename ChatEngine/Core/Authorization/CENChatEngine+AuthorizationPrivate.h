@@ -47,6 +47,23 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)handshakeChatAccess:(CENChat *)chat withCompletion:(dispatch_block_t)block;
 
+/**
+ * @brief Complete \b {chat CENChat} registration for \b {local user CENMe}.
+ *
+ * @discussion \b {Chat CENChat} will be added to \b {local user CENMe} custom \b {chats CENChat}
+ * group and granted read / write access.
+ *
+ * @param chat \b {Chat CENChat} for which user should be granted access.
+ * @param block Chat handshake completion handler block.
+ * @param failure Block which is called when handshake failed (before error will be thrown, so it
+ *     is called even if \b {CENConfiguration.throwExceptions} is enabled).
+ *
+ * @since 0.10.0
+ */
+- (void)handshakeChatAccess:(CENChat *)chat
+             withCompletion:(dispatch_block_t)block
+                    failure:(nullable dispatch_block_t)failure;
+
 #pragma mark -
 
 
@@ -145,6 +145,7 @@ NS_ASSUME_NONNULL_END
         [self setupClientLogger];
 
         _configuration = [configuration copy];
+        self.deliveryMode = _configuration.eventDeliveryMode;
         NSString *endpoint = _configuration.functionEndpoint;
         _pubNubConfiguration = [_configuration pubNubConfiguration];
         _functionClient = [CENPNFunctionClient clientWithEndpoint:endpoint logger:self.logger];
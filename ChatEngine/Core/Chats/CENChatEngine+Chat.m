@@ -67,9 +67,16 @@ CENChatGroups CENChatGroup = {
         NSNumber *isPrivate = args[NSStringFromSelector(@selector(private))];
         NSNumber *shouldAutoConnect = args[NSStringFromSelector(@selector(autoConnect))];
         NSDictionary *meta = args[NSStringFromSelector(@selector(meta))];
+        NSNumber *policy = args[NSStringFromSelector(@selector(participants))];
         CENChat *chat = nil;
 
-        if ([flags containsObject:NSStringFromSelector(@selector(create))]) {
+        if ([flags containsObject:NSStringFromSelector(@selector(create))] && policy) {
+            chat = [self createChatWithName:args[@"name"]
+                                    private:(isPrivate ? isPrivate.boolValue : NO)
+                                autoConnect:(shouldAutoConnect ? shouldAutoConnect.boolValue : YES)
+                                   metaData:meta
+                         participantsPolicy:(CENChatParticipantsPolicy)policy.unsignedIntegerValue];
+        } else if ([flags containsObject:NSStringFromSelector(@selector(create))]) {
             chat = [self createChatWithName:args[@"name"]
                                       group:nil
                                     private:(isPrivate ? isPrivate.boolValue : NO)
@@ -102,6 +109,21 @@ CENChatGroups CENChatGroup = {
                            metaData:meta];
 }
 
+- (CENChat *)createChatWithName:(NSString *)name
+                        private:(BOOL)isPrivate
+                    autoConnect:(BOOL)autoConnect
+                       metaData:(NSDictionary *)meta
+             participantsPolicy:(CENChatParticipantsPolicy)policy {
+    
+    return [self.chatsManager createGlobalChat:NO
+                                      withName:name
+                                         group:nil
+                                       private:isPrivate
+                                   autoConnect:autoConnect
+                                      metaData:meta
+                            participantsPolicy:policy];
+}
+
 - (CENChat *)createChatWithName:(NSString *)name
                           group:(NSString *)group
                         private:(BOOL)isPrivate
@@ -116,6 +138,11 @@ CENChatGroups CENChatGroup = {
                                       metaData:meta];
 }
 
+- (NSArray<CENChat *> *)createChatsWithNames:(NSArray<NSString *> *)names group:(NSString *)group {
+    
+    return [self.chatsManager createChatsWithNames:names group:group];
+}
+
 - (CENChat *)chatWithName:(NSString *)name private:(BOOL)isPrivate {
     
     CELogAPICall(self.logger, @"<ChatEngine::API> Get '%@' %@ chat.", name,
@@ -140,11 +167,8 @@ CENChatGroups CENChatGroup = {
 }
 
 - (CENChat *)createDirectChatForUser:(CENUser *)user {
-
-    NSString *namespace = self.configuration.globalChannel;
-    NSArray<NSString *> *nameComponents = @[namespace, @"user", user.uuid, @"write.", @"direct"];
     
-    return [self createChatWithName:[nameComponents componentsJoinedByString:@"#"]
+    return [self createChatWithName:[self nameOfChatForUserWithUUID:user.uuid direct:YES]
                               group:CENChatGroup.system
                             private:NO
                         autoConnect:NO
@@ -152,17 +176,36 @@ CENChatGroups CENChatGroup = {
 }
 
 - (CENChat *)createFeedChatForUser:(CENUser *)user {
-
-    NSString *namespace = self.configuration.globalChannel;
-    NSArray<NSString *> *nameComponents = @[namespace, @"user", user.uuid, @"read.", @"feed"];
     
-    return [self createChatWithName:[nameComponents componentsJoinedByString:@"#"]
+    return [self createChatWithName:[self nameOfChatForUserWithUUID:user.uuid direct:NO]
                               group:CENChatGroup.system
                             private:NO
                         autoConnect:NO
                            metaData:nil];
 }
 
+- (NSString *)nameOfChatForUserWithUUID:(NSString *)uuid direct:(BOOL)isDirect {
+    
+    NSString *namespace = self.configuration.globalChannel;
+    NSString *access = isDirect ? @"write." : @"read.";
+    NSString *type = isDirect ? @"direct" : @"feed";
+    NSArray<NSString *> *nameComponents = @[namespace, @"user", uuid, access, type];
+    
+    return [nameComponents componentsJoinedByString:@"#"];
+}
+
+- (void)removeChatsOfUsersWithUUIDs:(NSArray<NSString *> *)uuids {
+    
+    NSMutableArray<NSString *> *names = [NSMutableArray arrayWithCapacity:(uuids.count * 2)];
+    
+    for (NSString *uuid in uuids) {
+        [names addObject:[self nameOfChatForUserWithUUID:uuid direct:YES]];
+        [names addObject:[self nameOfChatForUserWithUUID:uuid direct:NO]];
+    }
+    
+    [self.chatsManager removeChats:[self.chatsManager chatsWithNames:names private:NO]];
+}
+
 - (void)removeChat:(CENChat *)chat {
     
     [self.chatsManager removeChat:chat];
@@ -330,6 +373,11 @@ CENChatGroups CENChatGroup = {
 }
 
 - (void)fetchParticipantsForChat:(CENChat *)chat {
+    
+    if (chat.participantsPolicy == CENChatParticipantsOccupancy) {
+        [self fetchOccupancyForChat:chat];
+        return;
+    }
 
     [self fetchParticipantsForChannel:chat.channel
                            completion:^(PNPresenceChannelHereNowResult *result,
@@ -348,8 +396,8 @@ CENChatGroups CENChatGroup = {
                     state = presenceData[@"state"];
                 }
                 
+                // State assigned by chat, so it will be able to report users with changed state.
                 CENUser *user = [self createUserWithUUID:uuid state:nil];
-                [user assignState:state forChat:chat];
                 states[user.uuid] = state;
                 
                 [participants addObject:user];
@@ -359,6 +407,32 @@ CENChatGroups CENChatGroup = {
             return;
         }
         
+        [chat handleParticipantsRefreshFailure];
+        
+        NSString *description = @"Getting presence of this Chat. Make sure PubNub presence is "
+                                "enabled for this key";
+        NSError *error = [CENError errorFromPubNubStatus:status withDescription:description];
+        
+        [self throwError:error
+                forScope:@"presence"
+                    from:chat
+           propagateFlow:CEExceptionPropagationFlow.middleware];
+    }];
+}
+
+- (void)fetchOccupancyForChat:(CENChat *)chat {
+    
+    [self fetchOccupancyForChannel:chat.channel
+                        completion:^(PNPresenceChannelHereNowResult *result,
+                                     PNErrorStatus *status) {
+        
+        if (!status) {
+            [chat handleRemoteOccupancyRefresh:result.data.occupancy.unsignedIntegerValue];
+            return;
+        }
+        
+        [chat handleParticipantsRefreshFailure];
+        
         NSString *description = @"Getting presence of this Chat. Make sure PubNub presence is "
                                 "enabled for this key";
         NSError *error = [CENError errorFromPubNubStatus:status withDescription:description];
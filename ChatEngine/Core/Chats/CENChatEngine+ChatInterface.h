@@ -69,6 +69,45 @@ NS_ASSUME_NONNULL_BEGIN
                     autoConnect:(BOOL)autoConnect
                        metaData:(nullable NSDictionary *)meta;
 
+/**
+ * @brief Create and configure new \b {chat CENChat} instance which will use specified policy to
+ * track its participants.
+ *
+ * @discussion Create \b {chat CENChat} which track only number of participants
+ * @code
+ * CENChat *chat = [self.client createChatWithName:@"lobby" private:NO autoConnect:YES
+ *                                        metaData:nil
+ *                              participantsPolicy:CENChatParticipantsOccupancy];
+ *
+ * [chat handleEvent:@"$.occupancy" withHandlerBlock:^(CENEmittedEvent *event) {
+ *     NSNumber *occupancy = event.data;
+ *
+ *     NSLog(@"There are %@ users in chat", occupancy);
+ * }];
+ * @endcode
+ *
+ * @param name Unique alphanumeric chat identifier with maximum 50 characters. Usually something
+ *     like \c {The Watercooler}, \c {Support}, or \c {Off Topic}.
+ *     \b Default: \a [NSDate date]
+ * @param isPrivate Whether \b {chat CENChat} access should be restricted only to invited
+ *     \b {users CENUser} or not.
+ * @param autoConnect Whether \b {local user CENMe} should be connected to this chat after creation
+ *     or not.
+ * @param meta Chat metadata that will be persisted on the server and populated on creation.
+ *     \b Default: \c @{}
+ * @param policy Policy which should be used by chat to track its participants. Ignored if chat
+ *     with same name already exists.
+ *
+ * @return Configured and ready to use \b {CENChat} instance.
+ *
+ * @since 0.10.0
+ */
+- (CENChat *)createChatWithName:(nullable NSString *)name
+                        private:(BOOL)isPrivate
+                    autoConnect:(BOOL)autoConnect
+                       metaData:(nullable NSDictionary *)meta
+             participantsPolicy:(CENChatParticipantsPolicy)policy;
+
 /**
  * @brief Try to find and return previously created \b {chat CENChat} instance.
  *
@@ -45,6 +45,22 @@ NS_ASSUME_NONNULL_BEGIN
                     autoConnect:(BOOL)autoConnect
                        metaData:(nullable NSDictionary *)meta;
 
+/**
+ * @brief Create batch of \b {chats CENChat} which won't be connected automatically.
+ *
+ * @param names List of chat names (may be internal channel names) for which chats should be found
+ *     or created.
+ * @param group Chats list group identifier. Available groups described in \b {CENChatGroup}
+ *     structure.
+ *     \b Default: \b {CENChatGroup.custom}
+ *
+ * @return List of configured \b {chats CENChat} in same order as \c names.
+ *
+ * @since 0.10.0
+ */
+- (NSArray<CENChat *> *)createChatsWithNames:(NSArray<NSString *> *)names
+                                       group:(nullable NSString *)group;
+
 /**
  * @brief Create and configure \b {CENChatEngine.global} chat.
  *
@@ -74,6 +90,30 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (CENChat *)createFeedChatForUser:(CENUser *)user;
 
+/**
+ * @brief Compose name of \b {user's CENUser} direct or feed \b {chat CENChat}.
+ *
+ * @param uuid Unique identifier of \b {user CENUser} for which chat name should be composed.
+ * @param isDirect Whether name of direct or feed \b {chat CENChat} should be composed.
+ *
+ * @return Name which is used by \b {user's CENUser} direct or feed \b {chat CENChat}.
+ *
+ * @since 0.10.0
+ */
+- (NSString *)nameOfChatForUserWithUUID:(NSString *)uuid direct:(BOOL)isDirect;
+
+/**
+ * @brief Remove \b {users' CENUser} direct and feed \b {chats CENChat} from local chat cache.
+ *
+ * @discussion Used when \b {users CENUser} evicted from users cache, so lazily created chats
+ * won't outlive them. All chats removed with single chats cache modification.
+ *
+ * @param uuids List of \b {users CENUser} unique identifiers for which chats should be removed.
+ *
+ * @since 0.10.0
+ */
+- (void)removeChatsOfUsersWithUUIDs:(NSArray<NSString *> *)uuids;
+
 /**
  * @brief Remove particular \b {chat CENChat} from local chat cache.
  *
@@ -175,6 +215,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)fetchParticipantsForChat:(CENChat *)chat;
 
+/**
+ * @brief Retrieve number of currently active \b {users CENUser} in specified chat.
+ *
+ * @discussion Used instead of participants list for chats which track only
+ * \b {CENChatParticipantsOccupancy}.
+ *
+ * @param chat \b {Chat CENChat} for which occupancy should be audited.
+ *
+ * @since 0.10.0
+ */
+- (void)fetchOccupancyForChat:(CENChat *)chat;
+
 
 #pragma mark - Clean up
 
@@ -1,4 +1,5 @@
 #import "CENInterfaceBuilder.h"
+#import "CENStructures.h"
 
 
 #pragma mark Class forward
@@ -79,6 +80,20 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, strong) CENChatBuilderInterface * (^meta)(NSDictionary *meta);
 
+/**
+ * @brief \b {Chat's CENChat} participants tracking policy addition block.
+ *
+ * @param policy Policy which should be used by chat to track its participants. Ignored if chat
+ *     with same name already exists.
+ *     \b Default: \b {CENChatParticipantsUsers}
+ *
+ * @return Builder instance which allow to complete chats management call configuration.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, strong) CENChatBuilderInterface * (^participants)
+    (CENChatParticipantsPolicy policy);
+
 /**
  * @brief \b {Chat's CENChat} group addition block.
  *
@@ -104,7 +119,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @note Builder parameters can be specified in different variations depending from needs.
  *
- * @chain name.private.autoConnect.meta.create
+ * @chain name.private.autoConnect.meta.participants.create
  *
  * @fires
  * - \b {$.created.chat CENChat}
@@ -52,6 +52,14 @@
     };
 }
 
+- (CENChatBuilderInterface * (^)(CENChatParticipantsPolicy policy))participants {
+    
+    return ^CENChatBuilderInterface * (CENChatParticipantsPolicy policy) {
+        [self setArgument:@(policy) forParameter:NSStringFromSelector(_cmd)];
+        return self;
+    };
+}
+
 - (CENChatBuilderInterface * (^)(NSString *group))group {
     
     return ^CENChatBuilderInterface * (NSString *__unused group) {
@@ -144,6 +144,47 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)unregisterProtoPluginWithIdentifier:(NSString *)identifier forObjectType:(NSString *)type;
 
+/**
+ * @brief Retrieve middlewares execution metrics collected since \b {CENChatEngine} creation.
+ *
+ * @discussion Find plugin which spent most of time processing received events
+ * @code
+ * // objc
+ * CENConfiguration *configuration = [CENConfiguration configurationWithPublishKey:@"demo-36"
+ *                                                                    subscribeKey:@"demo-36"];
+ * configuration.profileMiddlewares = YES;
+ * self.client = [CENChatEngine clientWithConfiguration:configuration];
+ *
+ * // Some time later.
+ * NSArray<NSDictionary *> *metrics = [self.client middlewareMetrics];
+ * NSSortDescriptor *duration = [NSSortDescriptor sortDescriptorWithKey:@"totalDuration"
+ *                                                            ascending:NO];
+ * NSLog(@"Slowest: %@", [metrics sortedArrayUsingDescriptors:@[duration]].firstObject);
+ * @endcode
+ *
+ * @note Metrics collected only if \b {CENConfiguration.profileMiddlewares} has been set to
+ * \c YES before \b {CENChatEngine} creation. Same metrics periodically emitted with
+ * \c $.metrics.middleware event if \b {CENConfiguration.middlewareMetricsInterval} is set.
+ *
+ * @return List of \a NSDictionary (one per plugin identifier, location and event) which use
+ * \b {CENMiddlewareMetrics} fields as keys.
+ *
+ * @since 0.10.0
+ */
+- (NSArray<NSDictionary *> *)middlewareMetrics;
+
+/**
+ * @brief Retrieve number of times when asynchronous middlewares didn't complete event processing
+ * within \b {CENConfiguration.middlewareTimeout}.
+ *
+ * @discussion Each timeout also reported with \c $.error.middleware.timeout event.
+ *
+ * @return Number of middleware timeouts since \b {CENChatEngine} creation.
+ *
+ * @since 0.10.0
+ */
+- (NSUInteger)middlewareTimeoutsCount;
+
 #pragma mark -
 
 
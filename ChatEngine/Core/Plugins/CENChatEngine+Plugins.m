@@ -116,6 +116,11 @@
     [self.pluginsManager unregisterAllFromObjects:object];
 }
 
+- (void)unregisterAllPluginsFromObjectWithIdentifier:(NSString *)identifier {
+    
+    [self.pluginsManager unregisterAllFromObjectWithIdentifier:identifier];
+}
+
 
 #pragma mark - Proto plugins
 
@@ -145,6 +150,12 @@
     [self.pluginsManager setupProtoPluginsForObject:object withCompletion:block];
 }
 
+- (void)setupProtoPluginsForObjects:(NSArray<CENObject *> *)objects
+                     withCompletion:(dispatch_block_t)block {
+    
+    [self.pluginsManager setupProtoPluginsForObjects:objects withCompletion:block];
+}
+
 - (void)registerProtoPlugin:(Class)cls
           withConfiguration:(NSDictionary *)configuration
               forObjectType:(NSString *)type {
@@ -203,6 +214,19 @@
 }
 
 
+#pragma mark - Metrics
+
+- (NSArray<NSDictionary *> *)middlewareMetrics {
+    
+    return [self.pluginsManager middlewareMetrics];
+}
+
+- (NSUInteger)middlewareTimeoutsCount {
+    
+    return self.pluginsManager.middlewareTimeoutsCount;
+}
+
+
 #pragma mark - Extension
 
 - (id)extensionForObject:(CENObject *)object withIdentifier:(NSString *)identifier {
@@ -68,6 +68,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)unregisterAllPluginsFromObjects:(CENObject *)object;
 
+/**
+ * @brief Remove all plugins of \b {object CENObject} which may not exist anymore.
+ *
+ * @param identifier Unique identifier of \b {object CENObject} for which plugins should be
+ *     removed.
+ *
+ * @since 0.10.0
+ */
+- (void)unregisterAllPluginsFromObjectWithIdentifier:(NSString *)identifier;
+
 
 #pragma mark - Proto plugins
 
@@ -80,6 +90,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)setupProtoPluginsForObject:(CENObject *)object withCompletion:(dispatch_block_t)block;
 
+/**
+ * @brief Setup plugins from proto for batch of \b {objects CENObject}.
+ *
+ * @param objects List of \b {objects CENObject} for which proto plugins should be found and
+ *     instantiated.
+ * @param block Plugins registration completion block which is called once for all \c objects.
+ *
+ * @since 0.10.0
+ */
+- (void)setupProtoPluginsForObjects:(NSArray<CENObject *> *)objects
+                     withCompletion:(nullable dispatch_block_t)block;
+
 
 #pragma mark - Extension
 
@@ -130,6 +130,15 @@ NS_ASSUME_NONNULL_END
     [self.pubnub hereNowForChannel:channel withVerbosity:PNHereNowState completion:block];
 }
 
+- (void)fetchOccupancyForChannel:(NSString *)channel completion:(PNHereNowCompletionBlock)block {
+    
+    if (![channel isKindOfClass:[NSString class]] || !channel.length) {
+        return;
+    }
+    
+    [self.pubnub hereNowForChannel:channel withVerbosity:PNHereNowOccupancy completion:block];
+}
+
 - (void)setClientState:(NSDictionary *)state
             forChannel:(NSString *)channel
         withCompletion:(PNSetStateCompletionBlock)block {
@@ -218,8 +227,7 @@ NS_ASSUME_NONNULL_END
 
 - (void)client:(PubNub *)__unused client didReceiveMessage:(PNMessageResult *)message {
     
-    BOOL isPrivate = [CENChat isPrivate:message.data.channel];
-    CENChat *chat = [self.chatsManager chatWithName:message.data.channel private:isPrivate];
+    CENChat *chat = [self.chatsManager chatForChannel:message.data.channel];
     NSMutableDictionary *messageWithTimetoken = [message.data.message mutableCopy];
     messageWithTimetoken[CENEventData.timetoken] = message.data.timetoken;
 
@@ -233,8 +241,7 @@ NS_ASSUME_NONNULL_END
 
 - (void)client:(PubNub *)__unused client didReceivePresenceEvent:(PNPresenceEventResult *)event {
     
-    BOOL isPrivate = [CENChat isPrivate:event.data.channel];
-    CENChat *chat = [self.chatsManager chatWithName:event.data.channel private:isPrivate];
+    CENChat *chat = [self.chatsManager chatForChannel:event.data.channel];
     
     if (![chat.group isEqualToString:CENChatGroup.system] || [chat isEqual:self.global]) {
         [self.chatsManager handleChat:chat presenceEvent:event.data];
@@ -99,6 +99,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)fetchParticipantsForChannel:(NSString *)channel completion:(PNHereNowCompletionBlock)block;
 
+/**
+ * @brief Retrieve number of participants in specific channel.
+ *
+ * @param channel Name \b {chat CENChat} channel for which occupancy should be fetched.
+ * @param block Block which will be called at the end of occupancy fetch and pass result or error
+ *     status.
+ *
+ * @since 0.10.0
+ */
+- (void)fetchOccupancyForChannel:(NSString *)channel completion:(PNHereNowCompletionBlock)block;
+
 /**
  * @brief Update state of \b {local user CENMe} at specific channel.
  *
@@ -35,6 +35,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, readonly, strong) CENMe *me;
 
+
+#pragma mark - Metrics
+
+/**
+ * @brief Retrieve information about number of known \b {users CENUser} and how many of them has
+ * been evicted because of \b {CENConfiguration.maximumUsersCount} limit.
+ *
+ * @discussion Check how many users has been evicted
+ * @code
+ * // objc
+ * NSDictionary<NSString *, NSNumber *> *metrics = [self.client usersMetrics];
+ * NSLog(@"Evicted %@ users", metrics[CENUsersMetrics.evictions]);
+ * @endcode
+ *
+ * @return \a NSDictionary which use \b {CENUsersMetrics} fields as keys.
+ *
+ * @since 0.10.0
+ */
+- (NSDictionary<NSString *, NSNumber *> *)usersMetrics;
+
 #pragma mark -
 
 
@@ -38,6 +38,14 @@
 }
 
 
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)usersMetrics {
+    
+    return [self.usersManager metrics];
+}
+
+
 #pragma mark - User
 
 #if CHATENGINE_USE_BUILDER_INTERFACE
@@ -103,13 +111,11 @@
                     forScope:@"getState"
                         from:user
                propagateFlow:CEExceptionPropagationFlow.middleware];
-            
-            return;
         }
         
-        if ([responses.firstObject isKindOfClass:[NSDictionary class]]) {
-            block(responses.firstObject);
-        }
+        // Completion called in any case, so callers which wait for state won't be stalled.
+        BOOL hasState = success && [responses.firstObject isKindOfClass:[NSDictionary class]];
+        block(hasState ? responses.firstObject : nil);
     }];
 }
 
@@ -26,11 +26,11 @@ NS_ASSUME_NONNULL_BEGIN
  * @param user \b {User CENUser} for which state should be fetched from \b PubNub K/V storage.
  * @param chat \b {Chat CENChat} to which state for user bound in \b PubNub K/V storage.
  * @param block Fetch completion block which pass \a NSDictionary with user's state for
- *     \b {chat CENChat}.
+ *     \b {chat CENChat} or \c nil in case if state fetch did fail.
  */
 - (void)fetchUserState:(CENUser *)user
                forChat:(CENChat *)chat
-        withCompletion:(void(^)(NSDictionary *state))block;
+        withCompletion:(void(^)(NSDictionary * __nullable state))block;
 
 
 #pragma mark - Clean up
@@ -1,4 +1,5 @@
 #import <Foundation/Foundation.h>
+#import "CENStructures.h"
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -138,6 +139,107 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign, getter = shouldDebugEvents) BOOL debugEvents
     NS_SWIFT_NAME(debugEvents);
 
+/**
+ * @brief Mode in which \b {CENChatEngine} and it's objects deliver emitted events to handlers.
+ *
+ * @discussion \b {CENEventDeliveryOrdered} guarantee what handlers will receive events in same
+ * order as they has been emitted by object. \b {CENEventDeliverySynchronous} call handlers on
+ * thread which emitted event (handlers shouldn't block it for long), except events which has been
+ * emitted by object while it updated own data - they delivered in order from separate queue.
+ *
+ * \b Default: \b {CENEventDeliveryConcurrent}
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) CENEventDeliveryMode eventDeliveryMode;
+
+/**
+ * @brief Whether \b {CENChatEngine} should collect middlewares execution metrics or not.
+ *
+ * @discussion Collected metrics include number of calls, number of rejections and latency
+ * histogram for each plugin, middleware location and event and can be retrieved with
+ * \b {CENChatEngine.middlewareMetrics}.
+ *
+ * \b Default: \c NO
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign, getter = shouldProfileMiddlewares) BOOL profileMiddlewares
+    NS_SWIFT_NAME(profileMiddlewares);
+
+/**
+ * @brief Number of seconds between \c $.metrics.middleware events emitted by
+ * \b {CENChatEngine} with collected middlewares execution metrics.
+ *
+ * @note Event emitted only if \b {profileMiddlewares} is set to \c YES. Negative values will be
+ * reset to \c 0.
+ *
+ * \b Default: \c 0 (event not emitted)
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSTimeInterval middlewareMetricsInterval;
+
+/**
+ * @brief Maximum number of seconds which asynchronous middleware can spend on event processing.
+ *
+ * @discussion If middleware won't complete in time, event processing will continue with payload
+ * which has been passed to this middleware (changes done by it are discarded) and
+ * \b {CENChatEngine} will emit \c $.error.middleware.timeout event. Middleware may specify own
+ * timeout using \b {CEPMiddleware.timeout}.
+ *
+ * @note Negative values will be reset to \c 0 which disable timeout.
+ *
+ * \b Default: \c 0 (not limited)
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSTimeInterval middlewareTimeout;
+
+/**
+ * @brief Maximum number of remote \b {users CENUser} which \b {CENChatEngine} keep in memory.
+ *
+ * @discussion When limit exceeded, least recently used users which aren't participants of any
+ * connected chat and not retained by application will be removed along with their plugins.
+ * Number of known users and evictions can be retrieved with \b {CENChatEngine.usersMetrics}.
+ *
+ * \b Default: \c 0 (not limited)
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger maximumUsersCount;
+
+/**
+ * @brief Maximum number of \b {chats CENChat} which \b {CENChatEngine} wake at the same time after
+ * \b {CENChatEngine.reconnect}.
+ *
+ * @discussion Each woken chat re-authenticates with the server, so clients with many chats may
+ * flood \b PubNub Functions with requests. When limit set, chats woken in batches: next chat
+ * starts its handshake only after one of active handshakes completes. Chats with higher
+ * \b {CENChat.wakePriority} woken first.
+ *
+ * \b Default: \c 0 (not limited)
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger maximumConcurrentChatWakes;
+
+/**
+ * @brief Whether \b {CENChatEngine} should report chat presence changes with single event or not.
+ *
+ * @discussion When enabled, changes from each presence update delivered as one
+ * \c $.online.batch event instead of separate \c $.online.join, \c $.online.here,
+ * \c $.offline.leave, \c $.offline.disconnect and \c $.state events for each user. Event pass
+ * \a NSDictionary with \b {CENPresenceBatch} keys and \c on middlewares called once per batch.
+ * Useful for chats with thousands of participants.
+ *
+ * \b Default: \c NO
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign, getter = shouldBatchPresenceEvents) BOOL batchPresenceEvents
+    NS_SWIFT_NAME(batchPresenceEvents);
+
 /**
  * @brief Whether \b {CENChatEngine} should throw errors or not.
  *
@@ -82,6 +82,25 @@ NS_ASSUME_NONNULL_END
     _functionEndpoint = [functionEndpoint copy];
 }
 
+- (void)setEventDeliveryMode:(CENEventDeliveryMode)eventDeliveryMode {
+    
+    if (eventDeliveryMode > CENEventDeliverySynchronous) {
+        eventDeliveryMode = kCENDefaultEventDeliveryMode;
+    }
+    
+    _eventDeliveryMode = eventDeliveryMode;
+}
+
+- (void)setMiddlewareMetricsInterval:(NSTimeInterval)middlewareMetricsInterval {
+    
+    _middlewareMetricsInterval = MAX(middlewareMetricsInterval, 0.f);
+}
+
+- (void)setMiddlewareTimeout:(NSTimeInterval)middlewareTimeout {
+    
+    _middlewareTimeout = MAX(middlewareTimeout, 0.f);
+}
+
 - (void)setPresenceHeartbeatValue:(NSInteger)presenceHeartbeatValue {
     
     _presenceHeartbeatValue = presenceHeartbeatValue;
@@ -138,6 +157,13 @@ NS_ASSUME_NONNULL_END
         _synchronizeSession = kCENDefaultShouldSynchronizeSession;
         _throwExceptions = kCENDefaultThrowsExceptions;
         _enableMeta = kCENDefaultEnableMeta;
+        _eventDeliveryMode = kCENDefaultEventDeliveryMode;
+        _profileMiddlewares = kCENDefaultProfileMiddlewares;
+        _middlewareMetricsInterval = kCENDefaultMiddlewareMetricsInterval;
+        _middlewareTimeout = kCENDefaultMiddlewareTimeout;
+        _maximumUsersCount = kCENDefaultMaximumUsersCount;
+        _maximumConcurrentChatWakes = kCENDefaultMaximumConcurrentChatWakes;
+        _batchPresenceEvents = kCENDefaultBatchPresenceEvents;
         _functionEndpoint = [self defaultFunctionEndpoint];
     }
     
@@ -158,6 +184,13 @@ NS_ASSUME_NONNULL_END
     configuration.enableMeta = self.enableMeta;
     configuration.debugEvents = self.shouldDebugEvents;
     configuration.throwExceptions = self.shouldThrowExceptions;
+    configuration.eventDeliveryMode = self.eventDeliveryMode;
+    configuration.profileMiddlewares = self.shouldProfileMiddlewares;
+    configuration.middlewareMetricsInterval = self.middlewareMetricsInterval;
+    configuration.middlewareTimeout = self.middlewareTimeout;
+    configuration.maximumUsersCount = self.maximumUsersCount;
+    configuration.maximumConcurrentChatWakes = self.maximumConcurrentChatWakes;
+    configuration.batchPresenceEvents = self.shouldBatchPresenceEvents;
     
     return configuration;
 }
@@ -50,10 +50,13 @@ NS_ASSUME_NONNULL_BEGIN
  * @param event Name of event which should be handled by \c block.
  * @param handler Block / closure which will handle specified \c event.
  *
+ * @return Opaque handler token which can be passed to \c -removeHandlerWithToken: to stop event
+ * handling.
+ *
  * @ref b64e680a-9ea2-4b24-820a-1908878ce2ac
  * @ref 135a906c-49e7-46ed-a835-311940b5a1e1
  */
-- (void)handleEvent:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)handler;
+- (id)handleEvent:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)handler;
 
 /**
  * @brief Subscribe on particular \c event which will be emitted by receiver and handle it once with
@@ -80,9 +83,12 @@ NS_ASSUME_NONNULL_BEGIN
  * @param event Name of event which should be handled by \c block.
  * @param handler Block / closure which will handle specified \c event.
  *
+ * @return Opaque handler token which can be passed to \c -removeHandlerWithToken: to stop event
+ * handling before it will be emitted.
+ *
  * @ref 7c771fc2-89ac-461f-864d-5d4b8ec646b2
  */
-- (void)handleEventOnce:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)handler;
+- (id)handleEventOnce:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)handler;
 
 
 #pragma mark - Handlers removal
@@ -125,6 +131,31 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)removeHandler:(CENEventHandlerBlock)handler forEvent:(NSString *)event;
 
+/**
+ * @brief Unsubscribe from particular event using token received during handler registration.
+ *
+ * @discussion Unlike \c -removeHandler:forEvent: it doesn't require to search handler among
+ * other handlers registered for same event, so it is preferred for objects which often add and
+ * remove handlers.
+ *
+ * @discussion Stop specific event handling
+ * @code
+ * // objc
+ * self.handlerToken = [self.object handleEvent:@"event" withHandlerBlock:^(CENEmittedEvent *event) {
+ *     // Handle 'event' emitted by object.
+ * }];
+ *
+ * // Later, when event handling not required anymore.
+ * [self.object removeHandlerWithToken:self.handlerToken];
+ * @endcode
+ *
+ * @param token Token which has been returned by \c -handleEvent:withHandlerBlock: or
+ *     \c -handleEventOnce:withHandlerBlock:.
+ *
+ * @since 0.10.0
+ */
+- (void)removeHandlerWithToken:(id)token;
+
 /**
  * @brief Unsubscribe all \c event handlers.
  *
@@ -6,6 +6,11 @@
 #import "CENEventEmitter.h"
 
 
+#pragma mark Class forward
+
+@class CENEventAtom;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Private interface declaration
@@ -13,6 +18,63 @@ NS_ASSUME_NONNULL_BEGIN
 @interface CENEventEmitter (Private)
 
 
+#pragma mark - Information
+
+/**
+ * @brief Mode in which emitted events should be delivered to registered handlers.
+ *
+ * \b Default: \b {CENEventDeliveryConcurrent}
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) CENEventDeliveryMode deliveryMode;
+
+
+#pragma mark - Configuration
+
+/**
+ * @brief Mark \c queue as queue on which handlers can't be called synchronously.
+ *
+ * @discussion Handlers may access emitting object's data through its resource access queue, so
+ * events emitted in \b {CENEventDeliverySynchronous} mode from such queue delivered in order on
+ * emitter's delivery queue instead.
+ *
+ * @param queue Serial queue which is used by object to synchronize access to its data.
+ *
+ * @since 0.10.0
+ */
++ (void)disallowSynchronousDeliveryOnQueue:(dispatch_queue_t)queue;
+
+
+#pragma mark - Handlers search
+
+/**
+ * @brief Check whether there is any handler which will be notified about \c event.
+ *
+ * @discussion Check is lock-free and doesn't allocate memory, so it can be used to skip preparation
+ * of event which nobody listens.
+ *
+ * @param event Name of event for which handlers should be checked.
+ *
+ * @return Whether any handler registered for \c event directly or through wildcard.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)hasHandlersForEvent:(NSString *)event;
+
+/**
+ * @brief Check whether there is any handler which will be notified about event represented by
+ * \c atom.
+ *
+ * @param atom Normalized name of event for which handlers should be checked.
+ *
+ * @return Whether any handler registered for event directly or through wildcard.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)hasHandlersForAtom:(CENEventAtom *)atom;
+
+
 #pragma mark - Events emitting
 
 /**
@@ -32,6 +94,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)emitEventLocally:(NSString *)event withParameters:(NSArray *)parameters;
 
+/**
+ * @brief Emit event represented by \c atom locally to all listeners.
+ *
+ * @discussion Event name normalized once by caller and \c atom passed to all emitters which
+ * should notify their listeners about same event.
+ *
+ * @param atom Normalized name of event for which listeners should be notified.
+ * @param parameters List of arguments which should be passed along with emitted event.
+ *
+ * @since 0.10.0
+ */
+- (void)emitEventAtom:(CENEventAtom *)atom withParameters:(NSArray *)parameters;
+
 
 #pragma mark - Clean up
 
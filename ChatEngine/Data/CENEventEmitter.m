@@ -11,53 +11,71 @@
 #endif // CHATENGINE_USE_BUILDER_INTERFACE
 
 #import "CENEmittedEvent+Private.h"
+#import "CENEventHandlersTree.h"
+#import "CENEventAtom.h"
+#import "CENEventHandler.h"
+#import <pthread.h>
 
 
 #pragma mark Static
 
 /**
- * @brief Key under which stored whether \c handler added for wildcard event or not.
- */
-static NSString * const kCENEventIsWildcardKey = @"iw";
-
-/**
- * @brief Key under which stored whether \c handler should handle any event or not.
- */
-static NSString * const kCENEventIsAnyKey = @"ae";
-
-/**
- * @brief Key under which actual event handling GCD block is stored.
- */
-static NSString * const kCENEventHandlerKey = @"h";
-
-/**
- * @brief Key under which stored flag with information on whether \c handler block should be called
- * only once or not.
+ * @brief Key which is used to mark queues on which handlers can't be called synchronously.
+ *
+ * @since 0.10.0
  */
-static NSString * const kCENEventIsOneTimeHandlerKey = @"oth";
+static char kCENEventEmitterNonSynchronousQueueKey;
 
 
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Protected interface declaration
 
-@interface CENEventEmitter ()
+@interface CENEventEmitter () {
+    /**
+     * @brief Lock which is used to protect list of pending deliveries in ordered delivery mode.
+     */
+    pthread_mutex_t _deliveryLock;
+    
+    /**
+     * @brief Whether pending deliveries drain block already scheduled on \c deliveryQueue or not.
+     */
+    BOOL _deliveryDrainScheduled;
+}
 
 
 #pragma mark - Information
 
 /**
- * @brief List of events handlers for wildcard (\c *) event.
+ * @brief Mode in which emitted events should be delivered to registered handlers.
  */
-@property (nonatomic, strong) NSMutableArray<NSDictionary *> *allEvents;
+@property (nonatomic, assign) CENEventDeliveryMode deliveryMode;
 
 /**
- * @brief \a NSDictionary where event names mapped to list of handlers for those events.
+ * @brief Queue which is used to deliver emitted events in \b {CENEventDeliveryOrdered} mode (and
+ * in \b {CENEventDeliverySynchronous} mode when event emitted from object's queue).
+ *
+ * @since 0.10.0
  */
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray<NSDictionary *> *> *events;
+@property (nonatomic, nullable, strong) dispatch_queue_t deliveryQueue;
 
 /**
- * @brief Queue which is used to serialize access to shared object information.
+ * @brief List of blocks which deliver emitted events and wait for \c deliveryQueue to drain them.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableArray<dispatch_block_t> *pendingDeliveries;
+
+/**
+ * @brief Tree of handlers registered for events (including wildcard events).
+ *
+ * @discussion Tree modifications serialized with \c eventsAccessQueue, but handlers search done
+ * without queue using immutable snapshots stored by tree nodes.
+ */
+@property (nonatomic, strong) CENEventHandlersTree *handlers;
+
+/**
+ * @brief Queue which is used to serialize handlers addition and removal.
  */
 @property (nonatomic, readonly, strong) dispatch_queue_t eventsAccessQueue;
 
@@ -72,68 +90,47 @@ NS_ASSUME_NONNULL_BEGIN
  * @param shouldNotifyOnce Whether passed \c block should be called only once for specified
  *     \c event or not.
  * @param block Block / closure which will be called when specified \c event emitted.
- */
-- (void)handleEvent:(NSString *)event
-                once:(BOOL)shouldNotifyOnce
-    withHandlerBlock:(CENEventHandlerBlock)block;
-
-
-#pragma mark - Events emitting
-
-/**
- * @brief Call passed \c handler with list of \c parameters.
  *
- * @param event Name of event about which handler should be notified.
- * @param data Listener's data object.
- * @param parameters List of parameters which should be passed to \c handler. Each value will be
- *     assigned to corresponding place in \c handler's block argument.
+ * @return Registered handler record which can be used as token to remove handler.
  */
-- (void)notifyAbout:(NSString *)event
-   usingHandlerData:(NSDictionary *)data
-     withParameters:(NSArray *)parameters;
+- (CENEventHandler *)handleEvent:(NSString *)event
+                             once:(BOOL)shouldNotifyOnce
+                 withHandlerBlock:(CENEventHandlerBlock)block;
 
 
-#pragma mark - Misc
+#pragma mark - Events emitting
 
 /**
- * @brief Search for event handler subscribed to specific \c event.
+ * @brief Deliver emitted event to handlers using current \c deliveryMode.
  *
- * @param event Name of event for which list of handlers should be found.
+ * @param delivery Block which notify event handlers.
  *
- * @return List of \c event handlers' data which can be used to notify handlers or for clean up.
+ * @since 0.10.0
  */
-- (NSArray<NSDictionary *> *)eventHandlersForEvent:(NSString *)event;
+- (void)scheduleDelivery:(dispatch_block_t)delivery;
 
 /**
- * @brief Match passed \c event against registered events list to find those which has complete
- * or partial (in case if \c event has wildcards) match.
+ * @brief Call all deliveries which has been scheduled in \b {CENEventDeliveryOrdered} mode.
  *
- * @param event \c event name which should be searched in registered events.
+ * @discussion Deliveries which has been scheduled while previous batch has been processed will be
+ * called from same block.
  *
- * @return List of registered events based on \c event name.
+ * @since 0.10.0
  */
-- (NSArray<NSString *> *)eventNamesForEvent:(NSString *)event;
+- (void)drainPendingDeliveries;
 
 /**
- * @brief Match passed \c event against registered events list to find those which has partial
- * match.
- *
- * @param event \c event name which should be searched in registered events.
+ * @brief Call passed \c handler with list of \c parameters.
  *
- * @return List of registered events based on \c event name.
+ * @param event Name of event about which handler should be notified.
+ * @param handler Registered handler record.
+ * @param parameters List of parameters which should be passed to \c handler. Each value will be
+ *     assigned to corresponding place in \c handler's block argument.
  */
-- (NSArray<NSString *> *)eventNamesForWildcardEvent:(NSString *)event;
+- (void)notifyAbout:(NSString *)event
+       usingHandler:(CENEventHandler *)handler
+     withParameters:(NSArray *)parameters;
 
-/**
- * @brief Calculate next level of \c event name.
- *
- * @param eventComponents Mutable array which contain event name components
- *     (\c event name separated by '.').
- *
- * @return Part of original event name, which is created from concatination of rest of elements from
- *     \c eventComponents.
- */
-- (nullable NSString *)nextEventNameFromComponents:(NSMutableArray<NSString *> *)eventComponents;
 
 #pragma mark -
 
@@ -152,17 +149,7 @@ NS_ASSUME_NONNULL_END
 
 - (NSArray<NSString *> *)eventNames {
     
-    __block NSMutableArray<NSString *> *eventNames = nil;
-    
-    dispatch_sync(self.eventsAccessQueue, ^{
-        eventNames = [NSMutableArray arrayWithArray:self.events.allKeys];
-        
-        if (self.allEvents.count) {
-            [eventNames insertObject:@"*" atIndex:0];
-        }
-    });
-    
-    return eventNames;
+    return self.handlers.eventNames;
 }
 
 
@@ -173,21 +160,48 @@ NS_ASSUME_NONNULL_END
     if ((self = [super init])) {
         NSString *identifier = [NSString stringWithFormat:@"com.chatengine.emitter.%p", self];
         _eventsAccessQueue = dispatch_queue_create([identifier UTF8String], DISPATCH_QUEUE_SERIAL);
-        _events = [NSMutableDictionary dictionary];
-        _allEvents = [NSMutableArray array];
+        _handlers = [CENEventHandlersTree new];
+        _pendingDeliveries = [NSMutableArray new];
+        pthread_mutex_init(&_deliveryLock, NULL);
     }
     
     return self;
 }
 
+- (void)setDeliveryMode:(CENEventDeliveryMode)deliveryMode {
+    
+    // Synchronous delivery fall back to ordered delivery when emitted from object's queue.
+    if (deliveryMode != CENEventDeliveryConcurrent && !self.deliveryQueue) {
+        NSString *identifier = [NSString stringWithFormat:@"com.chatengine.emitter.delivery.%p",
+                                self];
+        self.deliveryQueue = dispatch_queue_create([identifier UTF8String],
+                                                   DISPATCH_QUEUE_SERIAL);
+    }
+    
+    _deliveryMode = deliveryMode;
+}
+
 - (void)destruct {
     
     dispatch_sync(self.eventsAccessQueue, ^{
-        [self->_allEvents removeAllObjects];
-        [self->_events removeAllObjects];
+        [self->_handlers removeAllHandlers];
     });
 }
 
+- (void)dealloc {
+    
+    pthread_mutex_destroy(&_deliveryLock);
+}
+
+
+#pragma mark - Configuration
+
++ (void)disallowSynchronousDeliveryOnQueue:(dispatch_queue_t)queue {
+    
+    dispatch_queue_set_specific(queue, &kCENEventEmitterNonSynchronousQueueKey,
+                                &kCENEventEmitterNonSynchronousQueueKey, NULL);
+}
+
 
 #pragma mark - Handlers addition
 
@@ -217,40 +231,30 @@ NS_ASSUME_NONNULL_END
 }
 #endif // CHATENGINE_USE_BUILDER_INTERFACE
 
-- (void)handleEvent:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)block {
+- (id)handleEvent:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)block {
     
-    [self handleEvent:event once:NO withHandlerBlock:block];
+    return [self handleEvent:event once:NO withHandlerBlock:block];
 }
 
-- (void)handleEventOnce:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)block {
+- (id)handleEventOnce:(NSString *)event withHandlerBlock:(CENEventHandlerBlock)block {
     
-    [self handleEvent:event once:YES withHandlerBlock:block];
+    return [self handleEvent:event once:YES withHandlerBlock:block];
 }
 
-- (void)handleEvent:(NSString *)event
-                once:(BOOL)shouldNotifyOnce
-    withHandlerBlock:(CENEventHandlerBlock)block {
+- (CENEventHandler *)handleEvent:(NSString *)event
+                             once:(BOOL)shouldNotifyOnce
+                 withHandlerBlock:(CENEventHandlerBlock)block {
     
-    event = event.lowercaseString;
-    BOOL hasWildcard = [event rangeOfString:@"*"].location != NSNotFound;
-    BOOL isAllEvents = [event isEqualToString:@"*"];
+    event = [CENEventAtom atomForEvent:event].name;
+    CENEventHandler *handler = [CENEventHandler handlerForEvent:event
+                                                      withBlock:block
+                                                        oneTime:shouldNotifyOnce];
     
-    dispatch_async(self.eventsAccessQueue, ^{
-        NSMutableArray<NSDictionary *> *eventHandlers = (!isAllEvents ? self.events[event]
-                                                                      : self.allEvents);
-        
-        if (!eventHandlers && !isAllEvents) {
-            eventHandlers = [NSMutableArray array];
-            self.events[event] = eventHandlers;
-        }
-        
-        [eventHandlers addObject:@{
-            kCENEventIsAnyKey: @(isAllEvents),
-            kCENEventIsWildcardKey: @(!isAllEvents && hasWildcard),
-            kCENEventHandlerKey: block,
-            kCENEventIsOneTimeHandlerKey: @(shouldNotifyOnce)
-        }];
+    dispatch_sync(self.eventsAccessQueue, ^{
+        [self.handlers addHandler:handler forEvent:handler.event];
     });
+    
+    return handler;
 }
 
 
@@ -284,51 +288,57 @@ NS_ASSUME_NONNULL_END
 
 - (void)removeHandler:(CENEventHandlerBlock)block forEvent:(NSString *)event {
     
-    event = event.lowercaseString;
-    BOOL isAllEvents = [event isEqualToString:@"*"];
+    event = [CENEventAtom atomForEvent:event].name;
     
     dispatch_sync(self.eventsAccessQueue, ^{
-        __block NSDictionary *dataForRemoval = nil;
-        NSMutableArray<NSDictionary *> *eventHandlers = (!isAllEvents ? self.events[event]
-                                                                      : self.allEvents);
-        
-        for (NSDictionary *data in eventHandlers) {
-            if ([data[kCENEventHandlerKey] isEqual:block]) {
-                dataForRemoval = data;
+        for (CENEventHandler *handler in [self.handlers handlersStoredForEvent:event]) {
+            if ([handler.block isEqual:block]) {
+                [self.handlers removeHandler:handler forEvent:event];
+                [handler invalidate];
                 break;
             }
         }
-        
-        if (dataForRemoval) {
-            [eventHandlers removeObject:dataForRemoval];
-            
-            if (!isAllEvents && !eventHandlers.count) {
-                [self.events removeObjectForKey:event];
-            }
-        }
+    });
+}
+
+- (void)removeHandlerWithToken:(id)token {
+    
+    if (![token isKindOfClass:[CENEventHandler class]]) {
+        return;
+    }
+    
+    CENEventHandler *handler = token;
+    
+    dispatch_sync(self.eventsAccessQueue, ^{
+        [self.handlers removeHandler:handler forEvent:handler.event];
+        [handler invalidate];
     });
 }
 
 - (void)removeAllHandlersForEvent:(NSString *)event {
     
+    event = [CENEventAtom atomForEvent:event].name;
+    
     dispatch_sync(self.eventsAccessQueue, ^{
-        if (![event isEqualToString:@"*"]) {
-            if ([event rangeOfString:@"*"].location == NSNotFound) {
-                [self.events removeObjectForKey:event.lowercaseString];
-            } else {
-                NSArray<NSString *> *eventsToRemoveHandlers = [self eventNamesForEvent:event];
-                
-                for (NSString *eventName in eventsToRemoveHandlers) {
-                    [self.events removeObjectForKey:eventName.lowercaseString];
-                }
-            }
-        } else {
-            [self.allEvents removeAllObjects];
-        }
+        NSArray<CENEventHandler *> *handlers = [self.handlers removeAllHandlersForEvent:event];
+        [handlers makeObjectsPerformSelector:@selector(invalidate)];
     });
 }
 
 
+#pragma mark - Handlers search
+
+- (BOOL)hasHandlersForEvent:(NSString *)event {
+    
+    return [self.handlers hasHandlersForEvent:event];
+}
+
+- (BOOL)hasHandlersForAtom:(CENEventAtom *)atom {
+    
+    return [self.handlers hasHandlersForAtom:atom];
+}
+
+
 #pragma mark - Events emitting
 
 - (void)emitEventLocally:(NSString *)event, ... {
@@ -349,36 +359,122 @@ NS_ASSUME_NONNULL_END
 
 - (void)emitEventLocally:(NSString *)event withParameters:(NSArray *)parameters {
 
-    event = event.lowercaseString;
-    __block NSArray<NSDictionary *> *eventHandlers = nil;
+    CENEventAtom *atom = [CENEventAtom atomForEvent:event];
     
-    dispatch_sync(self.eventsAccessQueue, ^{
-        eventHandlers = [[self eventHandlersForEvent:event] copy];
+    if (atom) {
+        [self emitEventAtom:atom withParameters:parameters];
+    }
+}
+
+- (void)emitEventAtom:(CENEventAtom *)atom withParameters:(NSArray *)parameters {
+    
+    if (![self.handlers hasHandlersForAtom:atom]) {
+        return;
+    }
+    
+    NSString *event = atom.name;
+    NSMutableArray<CENEventHandler *> *eventHandlers = [NSMutableArray new];
+    NSMutableArray<CENEventHandler *> *oneTimeHandlers = nil;
+    
+    for (CENEventHandler *handler in [self.handlers handlersForAtom:atom]) {
+        if (handler.isOneTime) {
+            // Handler may be found by concurrent emit before it will be removed from tree.
+            if (![handler invalidate]) {
+                continue;
+            }
+            
+            oneTimeHandlers = oneTimeHandlers ?: [NSMutableArray new];
+            [oneTimeHandlers addObject:handler];
+        }
         
-        for (NSDictionary *data in eventHandlers) {
-            if (((NSNumber *)data[kCENEventIsOneTimeHandlerKey]).boolValue) {
-                [self.events[event] removeObject:data];
-                [self.allEvents removeObject:data];
+        [eventHandlers addObject:handler];
+    }
+    
+    if (oneTimeHandlers.count) {
+        dispatch_async(self.eventsAccessQueue, ^{
+            for (CENEventHandler *handler in oneTimeHandlers) {
+                [self.handlers removeHandler:handler forEvent:handler.event];
             }
+        });
+    }
+    
+    [self scheduleDelivery:^{
+        for (CENEventHandler *handler in eventHandlers) {
+            // Skip handlers which has been removed after emitted event handlers has been found.
+            if (!handler.isOneTime && handler.isInvalidated) {
+                continue;
+            }
+            
+            [self notifyAbout:event usingHandler:handler withParameters:parameters];
         }
+    }];
+}
+
+- (void)scheduleDelivery:(dispatch_block_t)delivery {
+    
+    CENEventDeliveryMode deliveryMode = self.deliveryMode;
+    
+    if (deliveryMode == CENEventDeliverySynchronous &&
+        dispatch_get_specific(&kCENEventEmitterNonSynchronousQueueKey)) {
         
-        if (self.events[event] && !self.events[event].count) {
-            [self.events removeObjectForKey:event];
+        // Handlers which access object's data would deadlock on queue which emitted event.
+        deliveryMode = CENEventDeliveryOrdered;
+    }
+    
+    if (deliveryMode == CENEventDeliverySynchronous) {
+        delivery();
+    } else if (deliveryMode == CENEventDeliveryOrdered) {
+        BOOL shouldScheduleDrain = NO;
+        
+        pthread_mutex_lock(&_deliveryLock);
+        [_pendingDeliveries addObject:delivery];
+        
+        if (!_deliveryDrainScheduled) {
+            _deliveryDrainScheduled = YES;
+            shouldScheduleDrain = YES;
         }
-    });
+        pthread_mutex_unlock(&_deliveryLock);
+        
+        if (shouldScheduleDrain) {
+            dispatch_async(self.deliveryQueue, ^{
+                [self drainPendingDeliveries];
+            });
+        }
+    } else {
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), delivery);
+    }
+}
+
+- (void)drainPendingDeliveries {
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-        for (NSDictionary *data in eventHandlers) {
-            [self notifyAbout:event usingHandlerData:data withParameters:parameters];
+    while (YES) {
+        NSArray<dispatch_block_t> *deliveries = nil;
+        
+        pthread_mutex_lock(&_deliveryLock);
+        if (_pendingDeliveries.count) {
+            deliveries = _pendingDeliveries;
+            _pendingDeliveries = [NSMutableArray new];
+        } else {
+            _deliveryDrainScheduled = NO;
         }
-    });
+        pthread_mutex_unlock(&_deliveryLock);
+        
+        if (!deliveries) {
+            break;
+        }
+        
+        @autoreleasepool {
+            for (dispatch_block_t delivery in deliveries) {
+                delivery();
+            }
+        }
+    }
 }
 
 - (void)notifyAbout:(NSString *)event
-   usingHandlerData:(NSDictionary *)data
+       usingHandler:(CENEventHandler *)handler
      withParameters:(NSArray *)parameters {
 
-    CENEventHandlerBlock handler = data[kCENEventHandlerKey];
     CENEventEmitter *emitter = self;
 
     if ([self superclass] == [CENEventEmitter class]) {
@@ -390,101 +486,9 @@ NS_ASSUME_NONNULL_END
 
     id emittedData = parameters.count ? parameters.firstObject : nil;
 
-    handler([CENEmittedEvent eventWithName:event data:emittedData emittedBy:emitter]);
-}
-
-
-#pragma mark - Misc
-
-- (NSArray<NSDictionary *> *)eventHandlersForEvent:(NSString *)event {
-    
-    NSMutableArray<NSDictionary *> *handlers = [NSMutableArray arrayWithArray:self.allEvents];
-    NSArray *eventNames = [self eventNamesForEvent:event];
-    
-    for (NSString *eventName in eventNames) {
-        [handlers addObjectsFromArray:self.events[eventName]];
-    };
-    
-    return handlers;
+    handler.block([CENEmittedEvent eventWithName:event data:emittedData emittedBy:emitter]);
 }
 
-- (NSArray<NSString *> *)eventNamesForEvent:(NSString *)event {
-    
-    NSMutableArray<NSString *> *eventNames = [NSMutableArray array];
-    NSMutableArray<NSString *> *components = [[event componentsSeparatedByString:@"."] mutableCopy];
-    NSArray<NSString *> *registeredEvents = self.events.allKeys;
-    NSUInteger componentsCount = components.count;
-    BOOL isXXWildcard = [event rangeOfString:@".**"].location != NSNotFound;
-    BOOL isXWildcard = !isXXWildcard && [event rangeOfString:@".*"].location != NSNotFound;
-
-    if (isXXWildcard || isXWildcard) {
-        [eventNames addObjectsFromArray:[self eventNamesForWildcardEvent:event]];
-    } else {
-        NSString *nextEventName = event;
-        
-        while (nextEventName != nil) {
-            NSString *xxEventName = [nextEventName stringByAppendingString:@".**"];
-            NSString *xEventName = [nextEventName stringByAppendingString:@".*"];
-            
-            if ([registeredEvents containsObject:nextEventName]) {
-                [eventNames addObject:nextEventName];
-            }
-            
-            if ((componentsCount - components.count) == 1 &&
-                [registeredEvents containsObject:xEventName]) {
-                
-                [eventNames addObject:xEventName];
-            }
-            
-            if ((componentsCount - components.count) >= 1 &&
-                [registeredEvents containsObject:xxEventName]) {
-                
-                [eventNames addObject:xxEventName];
-            }
-            
-            nextEventName = [self nextEventNameFromComponents:components];
-        }
-    }
-    
-    return eventNames;
-}
-
-- (NSArray<NSString *> *)eventNamesForWildcardEvent:(NSString *)event {
-    
-    NSMutableArray<NSString *> *eventNames = [NSMutableArray array];
-    NSMutableArray<NSString *> *components = [[event componentsSeparatedByString:@"."] mutableCopy];
-    BOOL isXXWildcard = [event rangeOfString:@".**"].location != NSNotFound;
-    BOOL isXWildcard = !isXXWildcard && [event rangeOfString:@".*"].location != NSNotFound;
-    NSArray<NSString *> *registeredEvents = self.events.allKeys;
-    
-    [components removeObject:components.lastObject];
-    NSString *cleared = [[components componentsJoinedByString:@"."] stringByAppendingString:@"."];
-    
-    for (NSString *registeredEvent in registeredEvents) {
-        if ([registeredEvent isEqualToString:event]) {
-            [eventNames addObject:event];
-        } else if ([registeredEvent rangeOfString:cleared].location == 0) {
-            NSString *prefixless = [registeredEvent stringByReplacingOccurrencesOfString:cleared
-                                                                             withString:@""];
-            NSUInteger prefixlessCount = [prefixless componentsSeparatedByString:@"."].count;
-            
-            if ((isXWildcard && prefixlessCount == 1) || (isXXWildcard && prefixlessCount >= 1)) {
-                [eventNames addObject:registeredEvent];
-            }
-        }
-    }
-    
-    return eventNames;
-}
-
-- (NSString *)nextEventNameFromComponents:(NSMutableArray<NSString *> *)eventComponents {
-    
-    if (eventComponents.count) {
-        [eventComponents removeObject:eventComponents.lastObject];
-    }
-    
-    return eventComponents.count ? [eventComponents componentsJoinedByString:@"."] : nil;
-}
 
 #pragma mark -
 
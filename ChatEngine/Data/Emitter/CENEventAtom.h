@@ -0,0 +1,64 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Normalized event name.
+ *
+ * @discussion Atom created once when event enters emitter or plugins manager and passed down to
+ * handlers and middlewares lookup, so event name lowercased and split on path components only
+ * once and not on every emitter, middleware or plugin which should match it.
+ *
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+@interface CENEventAtom : NSObject
+
+
+#pragma mark Information
+
+/**
+ * @brief Event name as it has been passed to \b {+atomForEvent:}.
+ */
+@property (nonatomic, readonly, copy) NSString *event;
+
+/**
+ * @brief Lowercased event name.
+ */
+@property (nonatomic, readonly, copy) NSString *name;
+
+/**
+ * @brief Event name path components (name separated by '.').
+ */
+@property (nonatomic, readonly, copy) NSArray<NSString *> *components;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Create normalized atom for \c event.
+ *
+ * @note Atoms not shared between calls, so they should be compared with \c -isEqual: and not by
+ * identity.
+ *
+ * @param event Name of event for which atom should be retrieved.
+ *
+ * @return Atom which represent \c event or \c nil in case if \c event is not \a NSString.
+ */
++ (nullable instancetype)atomForEvent:(nullable NSString *)event;
+
+/**
+ * @brief Instantiation should be done using class method \b {+atomForEvent:}.
+ *
+ * @return \c nil reference because instance can't be created this way.
+ */
+- (instancetype) __unavailable init;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
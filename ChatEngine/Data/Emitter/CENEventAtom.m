@@ -0,0 +1,111 @@
+/**
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+#import "CENEventAtom.h"
+
+
+#pragma mark Static
+
+/**
+ * @brief Separator which is used to split event name on path components.
+ */
+static NSString * const kCENEventAtomPathSeparator = @".";
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface CENEventAtom ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, copy) NSArray<NSString *> *components;
+@property (nonatomic, copy) NSString *event;
+@property (nonatomic, copy) NSString *name;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Initialize event name atom.
+ *
+ * @param event Name of event which should be represented by atom.
+ *
+ * @return Initialized and ready to use atom.
+ */
+- (instancetype)initWithEvent:(NSString *)event;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation CENEventAtom
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)atomForEvent:(NSString *)event {
+    
+    if (![event isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+    
+    return [[self alloc] initWithEvent:event];
+}
+
+- (instancetype)init {
+    
+    [NSException raise:NSDestinationInvalidException
+                format:@"-init not implemented, please use: +atomForEvent:"];
+    
+    return nil;
+}
+
+- (instancetype)initWithEvent:(NSString *)event {
+    
+    if ((self = [super init])) {
+        _event = [event copy];
+        _name = event.lowercaseString;
+        _components = [_name componentsSeparatedByString:kCENEventAtomPathSeparator];
+    }
+    
+    return self;
+}
+
+
+#pragma mark - Misc
+
+- (BOOL)isEqual:(id)object {
+    
+    if (object == self) {
+        return YES;
+    }
+    
+    return [object isKindOfClass:[CENEventAtom class]] &&
+           [((CENEventAtom *)object).name isEqualToString:self.name];
+}
+
+- (NSUInteger)hash {
+    
+    return self.name.hash;
+}
+
+- (NSString *)description {
+    
+    return [NSString stringWithFormat:@"<CENEventAtom:%p name: '%@'>", self, self.name];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,77 @@
+#import <Foundation/Foundation.h>
+#import "CENStructures.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Registered event handler record.
+ *
+ * @discussion Record used by \b {emitter CENEventEmitter} to store information about handler and
+ * returned to caller as opaque token which can be used to remove handler.
+ *
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+@interface CENEventHandler : NSObject
+
+
+#pragma mark Information
+
+/**
+ * @brief Block / closure which should be called when \c event emitted.
+ */
+@property (nonatomic, readonly, copy) CENEventHandlerBlock block;
+
+/**
+ * @brief Name of event for which handler has been registered.
+ */
+@property (nonatomic, readonly, copy) NSString *event;
+
+/**
+ * @brief Whether handler should be called only once or not.
+ */
+@property (nonatomic, readonly, getter = isOneTime, assign) BOOL oneTime;
+
+/**
+ * @brief Whether handler has been removed or (for one time handler) already used.
+ */
+@property (nonatomic, readonly, getter = isInvalidated, assign) BOOL invalidated;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Create and configure event handler record.
+ *
+ * @param event Name of event for which handler has been registered.
+ * @param block Block / closure which should be called when \c event emitted.
+ * @param oneTime Whether handler should be called only once or not.
+ *
+ * @return Configured and ready to use event handler record.
+ */
++ (instancetype)handlerForEvent:(NSString *)event
+                      withBlock:(CENEventHandlerBlock)block
+                        oneTime:(BOOL)oneTime;
+
+
+#pragma mark - State
+
+/**
+ * @brief Mark handler as invalidated.
+ *
+ * @discussion Invalidation is atomic, so only one of concurrent callers will receive \c YES.
+ * This is used to ensure that one time handler will be called only once, even if it has been found
+ * by concurrent emits.
+ *
+ * @return Whether handler has been invalidated by this call or not.
+ */
+- (BOOL)invalidate;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
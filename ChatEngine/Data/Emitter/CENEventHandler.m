@@ -0,0 +1,95 @@
+/**
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+#import "CENEventHandler.h"
+#import <stdatomic.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface CENEventHandler () {
+    /**
+     * @brief Whether handler has been removed or (for one time handler) already used.
+     */
+    atomic_bool _invalidationFlag;
+}
+
+
+#pragma mark - Information
+
+@property (nonatomic, getter = isOneTime, assign) BOOL oneTime;
+@property (nonatomic, copy) CENEventHandlerBlock block;
+@property (nonatomic, copy) NSString *event;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Initialize event handler record.
+ *
+ * @param event Name of event for which handler has been registered.
+ * @param block Block / closure which should be called when \c event emitted.
+ * @param oneTime Whether handler should be called only once or not.
+ *
+ * @return Initialized and ready to use event handler record.
+ */
+- (instancetype)initForEvent:(NSString *)event
+                   withBlock:(CENEventHandlerBlock)block
+                     oneTime:(BOOL)oneTime;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation CENEventHandler
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)handlerForEvent:(NSString *)event
+                      withBlock:(CENEventHandlerBlock)block
+                        oneTime:(BOOL)oneTime {
+
+    return [[self alloc] initForEvent:event withBlock:block oneTime:oneTime];
+}
+
+- (instancetype)initForEvent:(NSString *)event
+                   withBlock:(CENEventHandlerBlock)block
+                     oneTime:(BOOL)oneTime {
+
+    if ((self = [super init])) {
+        _event = [event copy];
+        _block = [block copy];
+        _oneTime = oneTime;
+    }
+
+    return self;
+}
+
+
+#pragma mark - State
+
+- (BOOL)isInvalidated {
+
+    return atomic_load(&_invalidationFlag);
+}
+
+- (BOOL)invalidate {
+
+    return !atomic_exchange(&_invalidationFlag, true);
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,153 @@
+#import <Foundation/Foundation.h>
+
+
+#pragma mark Class forward
+
+@class CENEventAtom;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Events handlers storage.
+ *
+ * @discussion Handlers stored in tree where each node represent one of event name path components
+ * (event name separated by '.'). Tree natively understands single (\c *) and multiple (\c **) level
+ * wildcards, so handlers lookup for emitted event is bound by event name depth and not by number of
+ * registered events.
+ *
+ * @note Tree doesn't serialize modifications and expect from caller to take care of it. Nodes
+ * children replaced with immutable snapshots on each modification. Node handlers stored in ordered
+ * set and copied to immutable snapshot by first search after modification, so handlers search can
+ * be done from any thread concurrently with modifications and take lock only to create snapshot.
+ *
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+@interface CENEventHandlersTree : NSObject
+
+
+#pragma mark Information
+
+/**
+ * @brief List of event names for which tree has registered handlers.
+ *
+ * @note If there is handlers registered for any event, \c * will be first in list.
+ */
+@property (nonatomic, readonly, strong) NSArray<NSString *> *eventNames;
+
+
+#pragma mark - Handlers management
+
+/**
+ * @brief Store \c handler for specified \c event.
+ *
+ * @param handler Object which represent registered handler.
+ * @param event Name of event for which \c handler should be stored. Name may contain wildcards or
+ *     be \c * to receive any event.
+ */
+- (void)addHandler:(id)handler forEvent:(NSString *)event;
+
+/**
+ * @brief Remove previously stored \c handler.
+ *
+ * @discussion Lookup cost bound by \c event name depth and handler removed in constant time.
+ *
+ * @param handler Object which has been used during \c handler addition.
+ * @param event Name of event for which \c handler has been stored.
+ */
+- (void)removeHandler:(id)handler forEvent:(NSString *)event;
+
+/**
+ * @brief Remove all handlers stored for \c event.
+ *
+ * @param event Name of event for which handlers should be removed. If name ends with wildcard, all
+ *     handlers stored for events which match it will be removed.
+ *
+ * @return List of removed handlers.
+ */
+- (NSArray *)removeAllHandlersForEvent:(NSString *)event;
+
+/**
+ * @brief Remove all handlers stored in tree.
+ */
+- (void)removeAllHandlers;
+
+
+#pragma mark - Handlers search
+
+/**
+ * @brief Retrieve list of handlers which has been stored exactly for \c event.
+ *
+ * @param event Name of event (as it has been used during handlers addition).
+ *
+ * @return List of handlers stored for \c event.
+ */
+- (NSArray *)handlersStoredForEvent:(NSString *)event;
+
+/**
+ * @brief Check whether there is at least one handler which should be notified about emitted
+ * \c event.
+ *
+ * @discussion Check doesn't allocate lists of handlers and stops on first matched node, so it can be
+ * used to skip emitting of events which nobody listens.
+ *
+ * @param event Name of emitted event.
+ *
+ * @return Whether any handler registered for \c event directly or through wildcard.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)hasHandlersForEvent:(NSString *)event;
+
+/**
+ * @brief Check whether there is at least one handler which should be notified about emitted event.
+ *
+ * @discussion Same as \b {-hasHandlersForEvent:}, but use path components of \c atom which has
+ * been created once for emitted event.
+ *
+ * @param atom Normalized name of emitted event.
+ *
+ * @return Whether any handler registered for event directly or through wildcard.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)hasHandlersForAtom:(CENEventAtom *)atom;
+
+/**
+ * @brief Retrieve list of handlers which should be notified about emitted \c event.
+ *
+ * @param event Name of emitted event.
+ *
+ * @return List of handlers which registered for \c event directly or through wildcard.
+ */
+- (NSArray *)handlersForEvent:(NSString *)event;
+
+/**
+ * @brief Retrieve list of handlers which should be notified about emitted event.
+ *
+ * @param atom Normalized name of emitted event.
+ *
+ * @return List of handlers which registered for event directly or through wildcard.
+ *
+ * @since 0.10.0
+ */
+- (NSArray *)handlersForAtom:(CENEventAtom *)atom;
+
+/**
+ * @brief Match passed \c event against registered events to find those which has complete or
+ * partial (in case if \c event has wildcards) match.
+ *
+ * @param event Name of event which should be searched in registered events.
+ *
+ * @return List of registered event names which match to \c event.
+ */
+- (NSArray<NSString *> *)eventNamesForEvent:(NSString *)event;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
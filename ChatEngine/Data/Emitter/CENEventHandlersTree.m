@@ -0,0 +1,630 @@
+/**
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+#import "CENEventHandlersTree.h"
+#import "CENEventAtom.h"
+#import <pthread.h>
+
+
+#pragma mark Static
+
+/**
+ * @brief Separator which is used to split event name on path components.
+ */
+static NSString * const kCENEventPathSeparator = @".";
+
+/**
+ * @brief Path component which match to any single event name path component.
+ */
+static NSString * const kCENEventSingleLevelWildcard = @"*";
+
+/**
+ * @brief Path component which match to one or more event name path components.
+ */
+static NSString * const kCENEventMultiLevelWildcard = @"**";
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/**
+ * @brief Handlers tree node which represent one of event name path components.
+ */
+@interface CENEventHandlersTreeNode : NSObject
+
+
+#pragma mark - Information
+
+/**
+ * @brief Nodes which represent next event name path component.
+ *
+ * @discussion Immutable snapshot which is replaced on each modification, so it can be read without
+ * locks while tree modified from other thread.
+ */
+@property (atomic, nullable, copy) NSDictionary<NSString *, CENEventHandlersTreeNode *> *children;
+
+/**
+ * @brief Node which represent previous event name path component.
+ */
+@property (nonatomic, nullable, weak) CENEventHandlersTreeNode *parent;
+
+/**
+ * @brief Handlers which has been stored for event represented by node.
+ *
+ * @note Should be accessed only while tree's \c _handlersLock is held.
+ */
+@property (nonatomic, strong) NSMutableOrderedSet *storedHandlers;
+
+/**
+ * @brief Immutable snapshot of \c storedHandlers.
+ *
+ * @discussion Snapshot reset on each modification and created by first handlers search after it,
+ * so series of modifications doesn't copy handlers list and search can use it without locks.
+ */
+@property (atomic, nullable, copy) NSArray *handlersSnapshot;
+
+/**
+ * @brief Number of handlers which has been stored for event represented by node.
+ */
+@property (atomic, assign) NSUInteger handlersCount;
+
+/**
+ * @brief Event name path component which is represented by node.
+ */
+@property (nonatomic, copy) NSString *component;
+
+/**
+ * @brief Full name of event which is represented by node.
+ */
+@property (nonatomic, copy) NSString *event;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Create and configure tree node.
+ *
+ * @param component Event name path component which is represented by node.
+ * @param event Full name of event which is represented by node.
+ * @param parent Node which represent previous event name path component.
+ *
+ * @return Configured and ready to use node.
+ */
++ (instancetype)nodeWithComponent:(NSString *)component
+                            event:(NSString *)event
+                           parent:(nullable CENEventHandlersTreeNode *)parent;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Protected interface declaration
+
+@interface CENEventHandlersTree () {
+    
+    /**
+     * @brief Lock which is used to protect nodes' \c storedHandlers while they modified or copied
+     * to snapshot.
+     */
+    pthread_mutex_t _handlersLock;
+}
+
+
+#pragma mark - Information
+
+/**
+ * @brief Tree root node which store handlers for any event (\c *).
+ */
+@property (nonatomic, strong) CENEventHandlersTreeNode *root;
+
+
+#pragma mark - Nodes
+
+/**
+ * @brief Find node which represent first \c count of event name path \c components.
+ *
+ * @param components List of event name path components.
+ * @param count Number of components which should be used to find node.
+ * @param shouldCreate Whether missing nodes should be created or not.
+ *
+ * @return Node which represent requested event name or \c nil in case if it doesn't exists and
+ * \c shouldCreate is set to \c NO.
+ */
+- (nullable CENEventHandlersTreeNode *)nodeForComponents:(NSArray<NSString *> *)components
+                                                   count:(NSUInteger)count
+                                                  create:(BOOL)shouldCreate;
+
+/**
+ * @brief Find nodes which has handlers for event which match to event name path \c components.
+ *
+ * @param components Path components of event for which nodes should be found. Last component may
+ *     be wildcard to find all nodes under event name path.
+ *
+ * @return List of nodes which has handlers for event.
+ */
+- (NSArray<CENEventHandlersTreeNode *> *)nodesForComponents:(NSArray<NSString *> *)components;
+
+/**
+ * @brief Walk through nodes which has handlers for event which match to event name path
+ * \c components.
+ *
+ * @param components Path components of event for which nodes should be found. Last component may
+ *     be wildcard to find all nodes under event name path.
+ * @param block Block which is called for each found node. Block can set \c stop to \c YES to stop
+ *     search.
+ *
+ * @since 0.10.0
+ */
+- (void)enumerateNodesForComponents:(NSArray<NSString *> *)components
+                               withBlock:(void(NS_NOESCAPE ^)(CENEventHandlersTreeNode *node,
+                                                         BOOL *stop))block;
+
+/**
+ * @brief Find nodes which has handlers under specified \c node.
+ *
+ * @param node Node from which search should be started.
+ * @param depth How deep search should go. \c 1 means only direct node's children.
+ * @param nodes List to which found nodes should be added.
+ */
+- (void)addNodesFrom:(CENEventHandlersTreeNode *)node
+           withDepth:(NSUInteger)depth
+              toList:(NSMutableArray<CENEventHandlersTreeNode *> *)nodes;
+
+/**
+ * @brief Remove nodes which doesn't have handlers nor children starting from \c node and up to
+ * root.
+ *
+ * @param node Node from which clean up should start.
+ */
+- (void)pruneNode:(CENEventHandlersTreeNode *)node;
+
+
+#pragma mark - Handlers
+
+/**
+ * @brief Retrieve list of handlers stored by \c node.
+ *
+ * @discussion Lock taken only if snapshot has been reset by modification since last call.
+ *
+ * @param node Node from which handlers should be retrieved.
+ *
+ * @return Immutable snapshot of node's handlers.
+ *
+ * @since 0.10.0
+ */
+- (NSArray *)handlersOfNode:(CENEventHandlersTreeNode *)node;
+
+/**
+ * @brief Modify handlers stored by \c node.
+ *
+ * @param node Node for which handlers should be modified.
+ * @param block Block which is called while lock is held and pass mutable handlers set.
+ *
+ * @since 0.10.0
+ */
+- (void)updateHandlersOfNode:(CENEventHandlersTreeNode *)node
+                   withBlock:(void(NS_NOESCAPE ^)(NSMutableOrderedSet *handlers))block;
+
+
+#pragma mark - Misc
+
+/**
+ * @brief Retrieve event name path components.
+ *
+ * @discussion Used only by handlers management, emitted events matched using components of
+ * \b {event name atom CENEventAtom} which has been created by emitter.
+ *
+ * @param event Name of event for which path components should be retrieved.
+ *
+ * @return List of event name path components.
+ */
+- (NSArray<NSString *> *)pathComponentsForEvent:(NSString *)event;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation CENEventHandlersTreeNode
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)nodeWithComponent:(NSString *)component
+                            event:(NSString *)event
+                           parent:(CENEventHandlersTreeNode *)parent {
+
+    CENEventHandlersTreeNode *node = [self new];
+    node.storedHandlers = [NSMutableOrderedSet new];
+    node.handlersSnapshot = @[];
+    node.component = component;
+    node.parent = parent;
+    node.event = event;
+
+    return node;
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation CENEventHandlersTree
+
+
+#pragma mark - Information
+
+- (NSArray<NSString *> *)eventNames {
+
+    NSMutableArray<CENEventHandlersTreeNode *> *nodes = [NSMutableArray new];
+    NSMutableArray<NSString *> *eventNames = [NSMutableArray new];
+
+    if (self.root.handlersCount) {
+        [eventNames addObject:self.root.event];
+    }
+
+    [self addNodesFrom:self.root withDepth:NSUIntegerMax toList:nodes];
+
+    for (CENEventHandlersTreeNode *node in nodes) {
+        [eventNames addObject:node.event];
+    }
+
+    return eventNames;
+}
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+
+    if ((self = [super init])) {
+        _root = [CENEventHandlersTreeNode nodeWithComponent:kCENEventSingleLevelWildcard
+                                                      event:kCENEventSingleLevelWildcard
+                                                     parent:nil];
+        pthread_mutex_init(&_handlersLock, NULL);
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    pthread_mutex_destroy(&_handlersLock);
+}
+
+
+#pragma mark - Handlers management
+
+- (void)addHandler:(id)handler forEvent:(NSString *)event {
+
+    CENEventHandlersTreeNode *node = self.root;
+
+    if (![event isEqualToString:kCENEventSingleLevelWildcard]) {
+        NSArray<NSString *> *components = [self pathComponentsForEvent:event];
+        node = [self nodeForComponents:components count:components.count create:YES];
+    }
+
+    [self updateHandlersOfNode:node withBlock:^(NSMutableOrderedSet *handlers) {
+        [handlers addObject:handler];
+    }];
+}
+
+- (void)removeHandler:(id)handler forEvent:(NSString *)event {
+
+    CENEventHandlersTreeNode *node = self.root;
+
+    if (![event isEqualToString:kCENEventSingleLevelWildcard]) {
+        NSArray<NSString *> *components = [self pathComponentsForEvent:event];
+        node = [self nodeForComponents:components count:components.count create:NO];
+    }
+
+    if (!node) {
+        return;
+    }
+
+    [self updateHandlersOfNode:node withBlock:^(NSMutableOrderedSet *handlers) {
+        [handlers removeObject:handler];
+    }];
+
+    [self pruneNode:node];
+}
+
+- (NSArray *)removeAllHandlersForEvent:(NSString *)event {
+
+    NSMutableArray *removedHandlers = [NSMutableArray new];
+    void(^removeBlock)(NSMutableOrderedSet *) = ^(NSMutableOrderedSet *handlers) {
+        [removedHandlers addObjectsFromArray:handlers.array];
+        [handlers removeAllObjects];
+    };
+
+    if ([event isEqualToString:kCENEventSingleLevelWildcard]) {
+        [self updateHandlersOfNode:self.root withBlock:removeBlock];
+
+        return removedHandlers;
+    }
+
+    NSArray<NSString *> *components = [self pathComponentsForEvent:event];
+    NSString *lastComponent = components.lastObject;
+    NSArray<CENEventHandlersTreeNode *> *nodes = nil;
+
+    if ([lastComponent isEqualToString:kCENEventSingleLevelWildcard] ||
+        [lastComponent isEqualToString:kCENEventMultiLevelWildcard]) {
+
+        nodes = [self nodesForComponents:components];
+    } else {
+        CENEventHandlersTreeNode *node = [self nodeForComponents:components
+                                                           count:components.count
+                                                          create:NO];
+        nodes = node ? @[node] : nil;
+    }
+
+    for (CENEventHandlersTreeNode *node in nodes) {
+        [self updateHandlersOfNode:node withBlock:removeBlock];
+        [self pruneNode:node];
+    }
+
+    return removedHandlers;
+}
+
+- (void)removeAllHandlers {
+
+    [self updateHandlersOfNode:self.root withBlock:^(NSMutableOrderedSet *handlers) {
+        [handlers removeAllObjects];
+    }];
+
+    self.root.children = nil;
+}
+
+
+#pragma mark - Handlers search
+
+- (NSArray *)handlersStoredForEvent:(NSString *)event {
+
+    CENEventHandlersTreeNode *node = self.root;
+
+    if (![event isEqualToString:kCENEventSingleLevelWildcard]) {
+        NSArray<NSString *> *components = [self pathComponentsForEvent:event];
+        node = [self nodeForComponents:components count:components.count create:NO];
+    }
+
+    return node ? [self handlersOfNode:node] : @[];
+}
+
+- (BOOL)hasHandlersForEvent:(NSString *)event {
+
+    return [self hasHandlersForAtom:[CENEventAtom atomForEvent:event]];
+}
+
+- (BOOL)hasHandlersForAtom:(CENEventAtom *)atom {
+
+    if (self.root.handlersCount) {
+        return YES;
+    }
+
+    if (!self.root.children.count) {
+        return NO;
+    }
+
+    __block BOOL hasHandlers = NO;
+
+    [self enumerateNodesForComponents:atom.components
+                            withBlock:^(CENEventHandlersTreeNode *node, BOOL *stop) {
+        hasHandlers = YES;
+        *stop = YES;
+    }];
+
+    return hasHandlers;
+}
+
+- (NSArray *)handlersForEvent:(NSString *)event {
+
+    return [self handlersForAtom:[CENEventAtom atomForEvent:event]];
+}
+
+- (NSArray *)handlersForAtom:(CENEventAtom *)atom {
+
+    NSMutableArray *handlers = [NSMutableArray arrayWithArray:[self handlersOfNode:self.root]];
+
+    for (CENEventHandlersTreeNode *node in [self nodesForComponents:atom.components]) {
+        [handlers addObjectsFromArray:[self handlersOfNode:node]];
+    }
+
+    return handlers;
+}
+
+- (NSArray<NSString *> *)eventNamesForEvent:(NSString *)event {
+
+    NSArray<NSString *> *components = [self pathComponentsForEvent:event];
+    NSArray<CENEventHandlersTreeNode *> *nodes = [self nodesForComponents:components];
+    NSMutableArray<NSString *> *eventNames = [NSMutableArray arrayWithCapacity:nodes.count];
+
+    for (CENEventHandlersTreeNode *node in nodes) {
+        [eventNames addObject:node.event];
+    }
+
+    return eventNames;
+}
+
+
+#pragma mark - Nodes
+
+- (CENEventHandlersTreeNode *)nodeForComponents:(NSArray<NSString *> *)components
+                                          count:(NSUInteger)count
+                                         create:(BOOL)shouldCreate {
+
+    CENEventHandlersTreeNode *node = self.root;
+
+    for (NSUInteger componentIdx = 0; componentIdx < count && node; componentIdx++) {
+        NSString *component = components[componentIdx];
+        CENEventHandlersTreeNode *child = node.children[component];
+
+        if (!child && shouldCreate) {
+            NSString *event = component;
+
+            if (node != self.root) {
+                event = [@[node.event, component] componentsJoinedByString:kCENEventPathSeparator];
+            }
+
+            child = [CENEventHandlersTreeNode nodeWithComponent:component event:event parent:node];
+            NSMutableDictionary *children = [node.children mutableCopy] ?: [NSMutableDictionary new];
+            children[component] = child;
+            node.children = children;
+        }
+
+        node = child;
+    }
+
+    return node;
+}
+
+- (NSArray<CENEventHandlersTreeNode *> *)nodesForComponents:(NSArray<NSString *> *)components {
+
+    NSMutableArray<CENEventHandlersTreeNode *> *nodes = [NSMutableArray new];
+
+    [self enumerateNodesForComponents:components
+                            withBlock:^(CENEventHandlersTreeNode *node, BOOL *stop) {
+        [nodes addObject:node];
+    }];
+
+    return nodes;
+}
+
+- (void)enumerateNodesForComponents:(NSArray<NSString *> *)components
+                          withBlock:(void(NS_NOESCAPE ^)(CENEventHandlersTreeNode *node,
+                                                         BOOL *stop))block {
+
+    BOOL stop = NO;
+    BOOL isMultiLevel = [components.lastObject isEqualToString:kCENEventMultiLevelWildcard];
+    BOOL isSingleLevel = [components.lastObject isEqualToString:kCENEventSingleLevelWildcard];
+    NSUInteger componentsCount = components.count;
+
+    if (componentsCount > 1 && (isSingleLevel || isMultiLevel)) {
+        CENEventHandlersTreeNode *node = [self nodeForComponents:components
+                                                           count:componentsCount - 1
+                                                          create:NO];
+
+        if (node) {
+            NSMutableArray<CENEventHandlersTreeNode *> *nodes = [NSMutableArray new];
+            [self addNodesFrom:node withDepth:(isSingleLevel ? 1 : NSUIntegerMax) toList:nodes];
+
+            for (CENEventHandlersTreeNode *matchedNode in nodes) {
+                block(matchedNode, &stop);
+
+                if (stop) {
+                    break;
+                }
+            }
+        }
+
+        return;
+    }
+
+    CENEventHandlersTreeNode *node = self.root;
+
+    for (NSUInteger componentIdx = 0; componentIdx < componentsCount; componentIdx++) {
+        if (!(node = node.children[components[componentIdx]])) {
+            break;
+        }
+
+        NSUInteger componentsLeft = componentsCount - componentIdx - 1;
+        NSDictionary<NSString *, CENEventHandlersTreeNode *> *children = node.children;
+        CENEventHandlersTreeNode *singleLevel = children[kCENEventSingleLevelWildcard];
+        CENEventHandlersTreeNode *multiLevel = children[kCENEventMultiLevelWildcard];
+
+        if (node.handlersCount) {
+            block(node, &stop);
+        }
+
+        if (!stop && componentsLeft == 1 && singleLevel.handlersCount) {
+            block(singleLevel, &stop);
+        }
+
+        if (!stop && componentsLeft >= 1 && multiLevel.handlersCount) {
+            block(multiLevel, &stop);
+        }
+
+        if (stop) {
+            break;
+        }
+    }
+}
+
+- (void)addNodesFrom:(CENEventHandlersTreeNode *)node
+           withDepth:(NSUInteger)depth
+              toList:(NSMutableArray<CENEventHandlersTreeNode *> *)nodes {
+
+    for (CENEventHandlersTreeNode *child in node.children.allValues) {
+        if (child.handlersCount) {
+            [nodes addObject:child];
+        }
+
+        if (depth > 1) {
+            [self addNodesFrom:child withDepth:(depth - 1) toList:nodes];
+        }
+    }
+}
+
+- (void)pruneNode:(CENEventHandlersTreeNode *)node {
+
+    while (node && node != self.root && !node.handlersCount && !node.children.count) {
+        CENEventHandlersTreeNode *parent = node.parent;
+        NSMutableDictionary *children = [parent.children mutableCopy];
+
+        [children removeObjectForKey:node.component];
+        parent.children = children.count ? children : nil;
+        node = parent;
+    }
+}
+
+
+#pragma mark - Handlers
+
+- (NSArray *)handlersOfNode:(CENEventHandlersTreeNode *)node {
+
+    NSArray *handlers = node.handlersSnapshot;
+
+    if (!handlers) {
+        pthread_mutex_lock(&_handlersLock);
+        if (!(handlers = node.handlersSnapshot)) {
+            handlers = [node.storedHandlers.array copy];
+            node.handlersSnapshot = handlers;
+        }
+        pthread_mutex_unlock(&_handlersLock);
+    }
+
+    return handlers;
+}
+
+- (void)updateHandlersOfNode:(CENEventHandlersTreeNode *)node
+                   withBlock:(void(NS_NOESCAPE ^)(NSMutableOrderedSet *handlers))block {
+
+    pthread_mutex_lock(&_handlersLock);
+    block(node.storedHandlers);
+    node.handlersSnapshot = nil;
+    node.handlersCount = node.storedHandlers.count;
+    pthread_mutex_unlock(&_handlersLock);
+}
+
+
+#pragma mark - Misc
+
+- (NSArray<NSString *> *)pathComponentsForEvent:(NSString *)event {
+
+    return [CENEventAtom atomForEvent:event].components ?: @[];
+}
+
+#pragma mark -
+
+
+@end
@@ -1,4 +1,5 @@
 #import <Foundation/Foundation.h>
+#import "CENStructures.h"
 
 
 #pragma mark Class forward
@@ -110,6 +111,53 @@ NS_ASSUME_NONNULL_BEGIN
                   autoConnect:(BOOL)shouldAutoConnect
                      metaData:(nullable NSDictionary *)meta;
 
+/**
+ * @brief Create new \b {chat CENChat} which will use specified policy to track its participants.
+ *
+ * @param isGlobal Whether new chat should represent \b {CENChatEngine.global} communication chat or
+ *     not.
+ * @param name Unique alphanumeric chat identifier with maximum 50 characters.
+ *     \b Default: \a NSUUID
+ * @param group Chat list group identifier. Available groups described in \b {CENChatGroup}
+ *     structure.
+ *     \b Default: \b {CENChatGroup.custom}
+ * @param isPrivate Whether chat access should be restricted only to invited users or not.
+ * @param shouldAutoConnect Whether new instance should be connected after creation or not.
+ * @param meta Information which should be persisted on server.
+ * @param policy Policy which should be used by chat to track its participants. Ignored if chat
+ *     with same name already exists.
+ *
+ * @return Configured and ready to use \b {chat CENChat}.
+ *
+ * @since 0.10.0
+ */
+- (CENChat *)createGlobalChat:(BOOL)isGlobal
+                     withName:(nullable NSString *)name
+                        group:(nullable NSString *)group
+                      private:(BOOL)isPrivate
+                  autoConnect:(BOOL)shouldAutoConnect
+                     metaData:(nullable NSDictionary *)meta
+           participantsPolicy:(CENChatParticipantsPolicy)policy;
+
+/**
+ * @brief Create batch of \b {chats CENChat} from their channel names.
+ *
+ * @discussion Proto plugins for all created chats set up at once and created chats won't be
+ * connected automatically.
+ *
+ * @param names List of chat names (may be internal channel names) for which chats should be found
+ *     or created.
+ * @param group Chat list group identifier. Available groups described in \b {CENChatGroup}
+ *     structure.
+ *     \b Default: \b {CENChatGroup.custom}
+ *
+ * @return List of existing or created \b {chats CENChat} in same order as \c names.
+ *
+ * @since 0.10.0
+ */
+- (NSArray<CENChat *> *)createChatsWithNames:(NSArray<NSString *> *)names
+                                       group:(nullable NSString *)group;
+
 
 #pragma mark - Audition
 
@@ -123,6 +171,35 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable CENChat *)chatWithName:(NSString *)name private:(BOOL)isPrivate;
 
+/**
+ * @brief Try to find and return previously created \b {chats CENChat} instances.
+ *
+ * @discussion Lookup done with single access to chats storage.
+ *
+ * @param names List of names of chats which has been created before.
+ * @param isPrivate Whether previously created chats are private or not.
+ *
+ * @return List of previously created \b {chats CENChat} (order not preserved, missing chats
+ *     skipped).
+ *
+ * @since 0.10.0
+ */
+- (NSArray<CENChat *> *)chatsWithNames:(NSArray<NSString *> *)names private:(BOOL)isPrivate;
+
+/**
+ * @brief Find \b {chat CENChat} which is represented by specified channel.
+ *
+ * @discussion Lookup done without locks and channel name transformations, so it can be used to
+ * route each message and presence event received from \b PubNub.
+ *
+ * @param channel Name of channel which is used internally by \b {chat CENChat}.
+ *
+ * @return Previously created \b {chat CENChat} instance or \c nil in case if it doesn't exists.
+ *
+ * @since 0.10.0
+ */
+- (nullable CENChat *)chatForChannel:(NSString *)channel;
+
 
 #pragma mark - Removal
 
@@ -133,6 +210,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)removeChat:(CENChat *)chat;
 
+/**
+ * @brief Remove list of \b {chats CENChat} from local chat cache.
+ *
+ * @discussion Chats removed with single storage modification and channels index rebuild.
+ *
+ * @param chats List of \b {chats CENChat} which should be removed from cache.
+ *
+ * @since 0.10.0
+ */
+- (void)removeChats:(NSArray<CENChat *> *)chats;
+
 
 #pragma mark - Handlers
 
@@ -10,17 +10,26 @@
 #import "CENChatEngine+Private.h"
 #import "CENObject+Private.h"
 #import "CENChat+Interface.h"
+#import "CENConfiguration.h"
 #import "CENUser+Private.h"
 #import "CENChat+Private.h"
 #import "CENStructures.h"
 #import "CENLogMacro.h"
+#import "CENDefines.h"
+#import <pthread.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
 
-@interface CENChatsManager ()
+@interface CENChatsManager () {
+    
+    /**
+     * @brief Lock which is used to protect access to chats wake queue.
+     */
+    pthread_mutex_t _wakeLock;
+}
 
 
 #pragma mark - Information
@@ -30,6 +39,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) NSMapTable<NSString *, CENChat *> *chatsMap;
 
+/**
+ * @brief Map of channel names to \b {chat CENChat} instance which they represent (including
+ * \b {CENChatEngine.global}).
+ *
+ * @discussion Immutable snapshot which is replaced on each \c chatsMap modification, so it can be
+ * read without locks while chats created or removed from other thread.
+ *
+ * @since 0.10.0
+ */
+@property (atomic, copy) NSDictionary<NSString *, CENChat *> *channelsIndex;
+
 /**
  * @brief Resource access serialization queue.
  */
@@ -45,6 +65,135 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) CENChat *global;
 
+/**
+ * @brief \b {Chats CENChat} which is waiting for free slot to be woken.
+ *
+ * @discussion Ordered by \b {CENChat.wakePriority} with \b {CENChatEngine.global} chat placed
+ * first.
+ *
+ * @note Should be accessed only while \c _wakeLock is held.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableOrderedSet<CENChat *> *pendingWakes;
+
+/**
+ * @brief Number of \b {chats CENChat} which currently is waking up.
+ *
+ * @note Should be accessed only while \c _wakeLock is held.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger activeWakesCount;
+
+/**
+ * @brief Maximum number of \b {chats CENChat} which can be woken at the same time (\c 0 if not
+ * limited).
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger maximumConcurrentChatWakes;
+
+
+#pragma mark - Creation
+
+/**
+ * @brief Find existing or create new \b {chat CENChat} without proto plugins setup.
+ *
+ * @param isGlobal Whether chat should represent \b {CENChatEngine.global} communication chat or
+ *     not.
+ * @param name Unique alphanumeric chat identifier.
+ * @param group Chat list group identifier.
+ * @param isPrivate Whether chat access should be restricted only to invited users or not.
+ * @param autoConnect Whether chat will be connected after proto plugins setup or not (used for
+ *     logging).
+ * @param meta Information which should be persisted on server.
+ * @param policy Policy which should be used by created chat to track its participants.
+ * @param created Pointer which is used to report whether \b {chat CENChat} has been created by
+ *     this call or not.
+ *
+ * @return Existing or created \b {chat CENChat}.
+ *
+ * @since 0.10.0
+ */
+- (CENChat *)chatForGlobal:(BOOL)isGlobal
+                  withName:(nullable NSString *)name
+                     group:(nullable NSString *)group
+                   private:(BOOL)isPrivate
+               autoConnect:(BOOL)autoConnect
+                  metaData:(nullable NSDictionary *)meta
+        participantsPolicy:(CENChatParticipantsPolicy)policy
+                   created:(BOOL *)created;
+
+/**
+ * @brief Find existing or create new \b {chat CENChat} and store it in \c chatsMap.
+ *
+ * @note Should be called only with barrier on \c resourceAccessQueue. \c channelsIndex not
+ * updated by this method, so caller should update it once all chats stored.
+ *
+ * @param isGlobal Whether chat should represent \b {CENChatEngine.global} communication chat or
+ *     not.
+ * @param name Unique alphanumeric chat identifier.
+ * @param group Chat list group identifier.
+ * @param isPrivate Whether chat access should be restricted only to invited users or not.
+ * @param autoConnect Whether chat will be connected after proto plugins setup or not (used for
+ *     logging).
+ * @param meta Information which should be persisted on server.
+ * @param policy Policy which should be used by created chat to track its participants.
+ * @param created Pointer which is used to report whether \b {chat CENChat} has been created by
+ *     this call or not.
+ *
+ * @return Existing or created \b {chat CENChat}.
+ *
+ * @since 0.10.0
+ */
+- (CENChat *)storedChatForGlobal:(BOOL)isGlobal
+                        withName:(nullable NSString *)name
+                           group:(NSString *)group
+                         private:(BOOL)isPrivate
+                     autoConnect:(BOOL)autoConnect
+                        metaData:(nullable NSDictionary *)meta
+              participantsPolicy:(CENChatParticipantsPolicy)policy
+                         created:(BOOL *)created;
+
+/**
+ * @brief Restore event sender's state for \b {chat CENChat} if it track users.
+ *
+ * @param chat \b {Chat CENChat} for which state restore should be configured.
+ * @param isGlobal Whether \c chat represent \b {CENChatEngine.global} communication chat or not.
+ * @param group Chat list group identifier which has been used to find or create \c chat.
+ *
+ * @since 0.10.0
+ */
+- (void)restoreStateIfRequiredForChat:(CENChat *)chat
+                               global:(BOOL)isGlobal
+                                group:(NSString *)group;
+
+
+#pragma mark - Connection
+
+/**
+ * @brief Wake \b {chats CENChat} from \c pendingWakes while there is free slots.
+ *
+ * @discussion Slot released when chat completes its wake up (successfully or not) and next chat
+ * from queue woken.
+ *
+ * @since 0.10.0
+ */
+- (void)wakeNextChats;
+
+
+#pragma mark - Misc
+
+/**
+ * @brief Replace \c channelsIndex with snapshot of currently known chats.
+ *
+ * @note Should be called only with barrier on \c resourceAccessQueue.
+ *
+ * @since 0.10.0
+ */
+- (void)updateChannelsIndex;
+
 #pragma mark -
 
 
@@ -104,6 +253,10 @@ NS_ASSUME_NONNULL_END
         NSString *queue = [NSString stringWithFormat:@"com.chatengine.manager.chats.%p", self];
         _resourceAccessQueue = dispatch_queue_create([queue UTF8String], DISPATCH_QUEUE_CONCURRENT);
         _chatsMap = [NSMapTable strongToStrongObjectsMapTable];
+        _channelsIndex = @{};
+        _maximumConcurrentChatWakes = chatEngine.configuration.maximumConcurrentChatWakes;
+        _pendingWakes = [NSMutableOrderedSet new];
+        pthread_mutex_init(&_wakeLock, NULL);
         _chatEngine = chatEngine;
         
         CELogResourceAllocation(self.chatEngine.logger,
@@ -119,11 +272,73 @@ NS_ASSUME_NONNULL_END
 - (void)connectChats {
     
     dispatch_async(self.resourceAccessQueue, ^{
-        [[self.chatsMap objectEnumerator].allObjects makeObjectsPerformSelector:@selector(wake)];
-        [self->_global wake];
+        NSArray<CENChat *> *chats = [self.chatsMap objectEnumerator].allObjects;
+        CENChat *global = self->_global;
+        
+        if (!self.maximumConcurrentChatWakes) {
+            [chats makeObjectsPerformSelector:@selector(wake)];
+            [global wake];
+            return;
+        }
+        
+        pthread_mutex_lock(&self->_wakeLock);
+        [self.pendingWakes addObjectsFromArray:chats];
+        
+        if (global) {
+            [self.pendingWakes addObject:global];
+        }
+        
+        [self.pendingWakes sortWithOptions:NSSortStable
+                           usingComparator:^NSComparisonResult(CENChat *chat1, CENChat *chat2) {
+            if (chat1 == global || chat2 == global) {
+                return chat1 == global ? NSOrderedAscending : NSOrderedDescending;
+            }
+            
+            NSInteger priority1 = chat1.wakePriority;
+            NSInteger priority2 = chat2.wakePriority;
+            
+            if (priority1 == priority2) {
+                return NSOrderedSame;
+            }
+            
+            return priority1 > priority2 ? NSOrderedAscending : NSOrderedDescending;
+        }];
+        pthread_mutex_unlock(&self->_wakeLock);
+        
+        [self wakeNextChats];
     });
 }
 
+- (void)wakeNextChats {
+    
+    NSMutableArray<CENChat *> *chats = [NSMutableArray new];
+    
+    pthread_mutex_lock(&_wakeLock);
+    while (self.pendingWakes.count && self.activeWakesCount < self.maximumConcurrentChatWakes) {
+        [chats addObject:self.pendingWakes.firstObject];
+        [self.pendingWakes removeObjectAtIndex:0];
+        self.activeWakesCount++;
+    }
+    pthread_mutex_unlock(&_wakeLock);
+    
+    CENWeakify(self);
+    for (CENChat *chat in chats) {
+        [chat wakeWithCompletion:^{
+            CENStrongify(self);
+            
+            if (!self) {
+                return;
+            }
+            
+            pthread_mutex_lock(&self->_wakeLock);
+            self.activeWakesCount--;
+            pthread_mutex_unlock(&self->_wakeLock);
+            
+            [self wakeNextChats];
+        }];
+    }
+}
+
 - (void)resetChatsConnection {
     
     dispatch_async(self.resourceAccessQueue, ^{
@@ -136,6 +351,10 @@ NS_ASSUME_NONNULL_END
 
 - (void)disconnectChats {
     
+    pthread_mutex_lock(&_wakeLock);
+    [self.pendingWakes removeAllObjects];
+    pthread_mutex_unlock(&_wakeLock);
+    
     dispatch_async(self.resourceAccessQueue, ^{
         [[self.chatsMap objectEnumerator].allObjects makeObjectsPerformSelector:@selector(sleep)];
         [self->_global sleep];
@@ -152,12 +371,139 @@ NS_ASSUME_NONNULL_END
                   autoConnect:(BOOL)autoConnect
                      metaData:(NSDictionary *)meta {
     
+    return [self createGlobalChat:isGlobal
+                         withName:name
+                            group:group
+                          private:isPrivate
+                      autoConnect:autoConnect
+                         metaData:meta
+               participantsPolicy:CENChatParticipantsUsers];
+}
+
+- (CENChat *)createGlobalChat:(BOOL)isGlobal
+                     withName:(NSString *)name
+                        group:(NSString *)group
+                      private:(BOOL)isPrivate
+                  autoConnect:(BOOL)autoConnect
+                     metaData:(NSDictionary *)meta
+           participantsPolicy:(CENChatParticipantsPolicy)policy {
+    
+    BOOL chatCreated = NO;
+    CENChat *chat = [self chatForGlobal:isGlobal
+                               withName:name
+                                  group:group
+                                private:isPrivate
+                            autoConnect:autoConnect
+                               metaData:meta
+                     participantsPolicy:policy
+                                created:&chatCreated];
+    
+    if (chat && chatCreated) {
+        [self.chatEngine setupProtoPluginsForObject:chat withCompletion:^{
+            [chat onCreate];
+            
+            if (autoConnect) {
+                [chat connectChat];
+            }
+        }];
+    }
+    
+    return chat;
+}
+
+- (NSArray<CENChat *> *)createChatsWithNames:(NSArray<NSString *> *)names group:(NSString *)group {
+    
+    NSMutableArray<CENChat *> *chats = [NSMutableArray arrayWithCapacity:names.count];
+    NSMutableArray<CENChat *> *createdChats = [NSMutableArray new];
+    group = group ?: CENChatGroup.custom;
+    
+    // Whole batch stored under single barrier, so channels index rebuilt only once.
+    dispatch_barrier_sync(self.resourceAccessQueue, ^{
+        for (NSString *name in names) {
+            BOOL chatCreated = NO;
+            CENChat *chat = [self storedChatForGlobal:NO
+                                             withName:name
+                                                group:group
+                                              private:[CENChat isPrivate:name]
+                                          autoConnect:NO
+                                             metaData:nil
+                                   participantsPolicy:CENChatParticipantsUsers
+                                              created:&chatCreated];
+            
+            [chats addObject:chat];
+            
+            if (chatCreated) {
+                [createdChats addObject:chat];
+            }
+        }
+        
+        if (createdChats.count) {
+            [self updateChannelsIndex];
+        }
+    });
+    
+    for (CENChat *chat in chats) {
+        [self restoreStateIfRequiredForChat:chat global:NO group:group];
+    }
+    
+    if (createdChats.count) {
+        [self.chatEngine setupProtoPluginsForObjects:createdChats withCompletion:^{
+            [createdChats makeObjectsPerformSelector:@selector(onCreate)];
+        }];
+    }
+    
+    return chats;
+}
+
+- (CENChat *)chatForGlobal:(BOOL)isGlobal
+                  withName:(NSString *)name
+                     group:(NSString *)group
+                   private:(BOOL)isPrivate
+               autoConnect:(BOOL)autoConnect
+                  metaData:(NSDictionary *)meta
+        participantsPolicy:(CENChatParticipantsPolicy)policy
+                   created:(BOOL *)created {
+    
     __block CENChat *chat = nil;
     __block BOOL chatCreated = NO;
+    group = group ?: CENChatGroup.custom;
+    
+    dispatch_barrier_sync(self.resourceAccessQueue, ^{
+        BOOL stored = NO;
+        chat = [self storedChatForGlobal:isGlobal
+                                withName:name
+                                   group:group
+                                 private:isPrivate
+                             autoConnect:autoConnect
+                                metaData:meta
+                      participantsPolicy:policy
+                                 created:&stored];
+        
+        if (stored) {
+            [self updateChannelsIndex];
+        }
+        
+        chatCreated = stored;
+    });
+    
+    [self restoreStateIfRequiredForChat:chat global:isGlobal group:group];
+    *created = chatCreated;
+    
+    return chat;
+}
+
+- (CENChat *)storedChatForGlobal:(BOOL)isGlobal
+                        withName:(NSString *)name
+                           group:(NSString *)group
+                         private:(BOOL)isPrivate
+                     autoConnect:(BOOL)autoConnect
+                        metaData:(NSDictionary *)meta
+              participantsPolicy:(CENChatParticipantsPolicy)policy
+                         created:(BOOL *)created {
+    
     NSString *namespace = self.chatEngine.configuration.globalChannel;
     name = name ?: @((NSUInteger)[[NSDate date] timeIntervalSince1970]).stringValue;
     NSString *internalName = [CENChat internalNameFor:name inNamespace:namespace private:isPrivate];
-    group = group ?: CENChatGroup.custom;
     meta = meta ?: @{};
 
     if (!isGlobal && [internalName isEqualToString:name]) {
@@ -168,42 +514,38 @@ NS_ASSUME_NONNULL_END
         name, isPrivate ? @"private " : @"public ", group, autoConnect ? @" and connect" : @"",
         meta.count ? [@[@" Meta: ", meta] componentsJoinedByString:@""] : @"");
     
-    dispatch_barrier_sync(self.resourceAccessQueue, ^{
-        chat = isGlobal ? self->_global : [self.chatsMap objectForKey:internalName];
+    CENChat *chat = isGlobal ? self->_global : [self.chatsMap objectForKey:internalName];
+    *created = !chat;
+    
+    if (!chat) {
+        chat = [CENChat chatWithName:name
+                           namespace:namespace
+                               group:group
+                             private:isPrivate
+                            metaData:meta
+                  participantsPolicy:policy
+                          chatEngine:self.chatEngine];
         
-        if (!chat) {
-            chatCreated = YES;
-            chat = [CENChat chatWithName:name
-                               namespace:namespace
-                                   group:group
-                                 private:isPrivate
-                                metaData:meta
-                              chatEngine:self.chatEngine];
-            
-            if (isGlobal) {
-                self.global = chat;
-            } else {
-                [self.chatsMap setObject:chat forKey:internalName];
-            }
+        if (isGlobal) {
+            self.global = chat;
+        } else {
+            [self.chatsMap setObject:chat forKey:internalName];
         }
-    });
+    }
     
-    if (![group isEqualToString:CENChatGroup.system] || isGlobal) {
+    return chat;
+}
+
+- (void)restoreStateIfRequiredForChat:(CENChat *)chat
+                               global:(BOOL)isGlobal
+                                group:(NSString *)group {
+    
+    BOOL tracksUsers = chat.participantsPolicy == CENChatParticipantsUsers;
+    
+    if ((![group isEqualToString:CENChatGroup.system] || isGlobal) && tracksUsers) {
         // By default restore event sender's state using global chat (pre-0.10.0).
         [chat restoreStateForChat:nil];
     }
-    
-    if (chat && chatCreated) {
-        [self.chatEngine setupProtoPluginsForObject:chat withCompletion:^{
-            [chat onCreate];
-            
-            if (autoConnect) {
-                [chat connectChat];
-            }
-        }];
-    }
-    
-    return chat;
 }
 
 
@@ -229,15 +571,75 @@ NS_ASSUME_NONNULL_END
     return chat;
 }
 
+- (NSArray<CENChat *> *)chatsWithNames:(NSArray<NSString *> *)names private:(BOOL)isPrivate {
+    
+    NSMutableDictionary<NSString *, NSString *> *internalNames = [NSMutableDictionary new];
+    NSString *namespace = self.chatEngine.configuration.globalChannel;
+    NSMutableArray<CENChat *> *chats = [NSMutableArray new];
+    
+    for (NSString *name in names) {
+        if ([name isKindOfClass:[NSString class]] && name.length) {
+            internalNames[name] = [CENChat internalNameFor:name
+                                               inNamespace:namespace
+                                                   private:isPrivate];
+        }
+    }
+    
+    if (!internalNames.count) {
+        return chats;
+    }
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        for (NSString *name in internalNames) {
+            BOOL isGlobal = ([self->_global.name isEqualToString:name] ||
+                             [self->_global.channel isEqualToString:name]);
+            NSString *internalName = internalNames[name];
+            CENChat *chat = isGlobal ? self->_global : [self.chatsMap objectForKey:internalName];
+            
+            if (chat) {
+                [chats addObject:chat];
+            }
+        }
+    });
+    
+    return chats;
+}
+
+- (CENChat *)chatForChannel:(NSString *)channel {
+    
+    if (![channel isKindOfClass:[NSString class]] || !channel.length) {
+        return nil;
+    }
+    
+    return self.channelsIndex[channel];
+}
+
 
 #pragma mark - Removal
 
 - (void)removeChat:(CENChat *)chat {
     
-    [chat destruct];
+    [self removeChats:@[chat]];
+}
+
+- (void)removeChats:(NSArray<CENChat *> *)chats {
+    
+    if (!chats.count) {
+        return;
+    }
+    
+    [chats makeObjectsPerformSelector:@selector(destruct)];
+    
+    pthread_mutex_lock(&_wakeLock);
+    [self.pendingWakes removeObjectsInArray:chats];
+    pthread_mutex_unlock(&_wakeLock);
     
     dispatch_barrier_async(self.resourceAccessQueue, ^{
-        [self.chatsMap removeObjectForKey:chat.channel];
+        for (CENChat *chat in chats) {
+            [self.chatsMap removeObjectForKey:chat.channel];
+        }
+        
+        [self updateChannelsIndex];
     });
 }
 
@@ -260,6 +662,15 @@ NS_ASSUME_NONNULL_END
     }
     
     PNPresenceDetailsData *presenceData = information.presence;
+    
+    if (chat.participantsPolicy == CENChatParticipantsOccupancy) {
+        if (presenceData.occupancy) {
+            [chat handleRemoteOccupancyChange:presenceData.occupancy.unsignedIntegerValue];
+        }
+        
+        return;
+    }
+    
     NSString *eventType = information.presenceEvent;
     NSArray<NSString *> *join = presenceData.join.count ? presenceData.join : nil;
     NSArray<NSString *> *leave = presenceData.leave.count ? presenceData.leave : nil;
@@ -282,12 +693,26 @@ NS_ASSUME_NONNULL_END
         onStateChange = YES;
     }
     
-    [chat handleRemoteUsersJoin:[self.chatEngine.usersManager createUsersWithUUID:join]
-                     withStates:usersState onStateChange:onStateChange];
-    [chat handleRemoteUsersLeave:[self.chatEngine.usersManager createUsersWithUUID:leave]];
-    [chat handleRemoteUsersDisconnect:[self.chatEngine.usersManager createUsersWithUUID:timeout]];
-    [chat handleRemoteUsers:[self.chatEngine.usersManager createUsersWithUUID:stateChange]
-                stateChange:usersState];
+    CENUsersManager *usersManager = self.chatEngine.usersManager;
+    NSArray<CENUser *> *stateChangedUsers = [usersManager createUsersWithUUID:stateChange];
+    NSArray<CENUser *> *disconnectedUsers = [usersManager createUsersWithUUID:timeout];
+    NSArray<CENUser *> *joinedUsers = [usersManager createUsersWithUUID:join];
+    NSArray<CENUser *> *leftUsers = [usersManager createUsersWithUUID:leave];
+    
+    if (self.chatEngine.configuration.shouldBatchPresenceEvents) {
+        [chat handleRemoteUsersJoin:joinedUsers
+                              leave:leftUsers
+                         disconnect:disconnectedUsers
+                        stateChange:stateChangedUsers
+                         withStates:usersState];
+        
+        return;
+    }
+    
+    [chat handleRemoteUsersJoin:joinedUsers withStates:usersState onStateChange:onStateChange];
+    [chat handleRemoteUsersLeave:leftUsers];
+    [chat handleRemoteUsersDisconnect:disconnectedUsers];
+    [chat handleRemoteUsers:stateChangedUsers stateChange:usersState];
 }
 
 
@@ -295,12 +720,17 @@ NS_ASSUME_NONNULL_END
 
 - (void)destroy {
     
+    pthread_mutex_lock(&_wakeLock);
+    [self.pendingWakes removeAllObjects];
+    pthread_mutex_unlock(&_wakeLock);
+    
     dispatch_barrier_async(self.resourceAccessQueue, ^{
         NSArray<CENChat *> *chats = [self.chatsMap objectEnumerator].allObjects;
         [chats makeObjectsPerformSelector:@selector(destruct)];
         [self.chatsMap removeAllObjects];
         [self->_global destruct];
         self->_global = nil;
+        [self updateChannelsIndex];
     });
 }
 
@@ -308,6 +738,22 @@ NS_ASSUME_NONNULL_END
     
     CELogResourceAllocation(self.chatEngine.logger,
         @"<ChatEngine::Manager::Chats> %p instance deallocation", self);
+    
+    pthread_mutex_destroy(&_wakeLock);
+}
+
+
+#pragma mark - Misc
+
+- (void)updateChannelsIndex {
+    
+    NSMutableDictionary *index = [[self.chatsMap dictionaryRepresentation] mutableCopy];
+    
+    if (self->_global) {
+        index[self->_global.channel] = self->_global;
+    }
+    
+    self.channelsIndex = index;
 }
 
 #pragma mark -
@@ -0,0 +1,93 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * @brief Middlewares execution profiler.
+ *
+ * @discussion Profiler aggregate invocations count, rejections count and latency histogram for
+ * each plugin identifier, middleware location and event name. Event names expected to be
+ * normalized by caller with \b {CENEventAtom}, so same event with different letter case aggregated
+ * together. Number of tracked event names for each plugin identifier and location is limited and metrics for rest of
+ * events aggregated under \c other event name.
+ *
+ * @note Profiler can be used from any thread.
+ *
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+@interface CENMiddlewareProfiler : NSObject
+
+
+#pragma mark - Information
+
+/**
+ * @brief Current value of monotonic clock which should be used as middleware call start time.
+ *
+ * @return Clock value in host time units.
+ */
++ (uint64_t)timestamp;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Create and configure middlewares profiler.
+ *
+ * @return Configured and ready to use profiler.
+ */
++ (instancetype)profiler;
+
+
+#pragma mark - Recording
+
+/**
+ * @brief Record middleware call completion.
+ *
+ * @param identifier Unique identifier of plugin which provided middleware.
+ * @param location Location at which middleware has been called.
+ * @param event Normalized name of event which has been processed by middleware.
+ * @param startTimestamp Value returned by \c +timestamp right before middleware has been called.
+ * @param rejected Whether middleware rejected event payload or not.
+ */
+- (void)recordMiddlewareWithIdentifier:(NSString *)identifier
+                            atLocation:(NSString *)location
+                              forEvent:(NSString *)event
+                             startedAt:(uint64_t)startTimestamp
+                              rejected:(BOOL)rejected;
+
+/**
+ * @brief Record middleware which didn't complete event processing in time.
+ *
+ * @param identifier Unique identifier of plugin which provided middleware.
+ * @param location Location at which middleware has been called.
+ * @param event Normalized name of event which has been processed by middleware.
+ */
+- (void)recordTimeoutOfMiddlewareWithIdentifier:(NSString *)identifier
+                                     atLocation:(NSString *)location
+                                       forEvent:(NSString *)event;
+
+
+#pragma mark - Metrics
+
+/**
+ * @brief Retrieve current state of aggregated metrics.
+ *
+ * @return List of \a NSDictionary (one per plugin identifier, location and event) which use
+ * \b {CENMiddlewareMetrics} fields as keys.
+ */
+- (NSArray<NSDictionary *> *)snapshot;
+
+/**
+ * @brief Remove all aggregated metrics.
+ */
+- (void)reset;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,317 @@
+/**
+ * @author Serhii Mamontov
+ * @version 0.10.0
+ * @copyright © 2010-2019 PubNub, Inc.
+ */
+#import "CENMiddlewareProfiler.h"
+#import <mach/mach_time.h>
+#import "CENStructures.h"
+#import <pthread.h>
+
+
+#pragma mark Structures
+
+/**
+ * @brief Typedef structure fields assignment.
+ */
+CENMiddlewareMetricsKeys CENMiddlewareMetrics = {
+    .identifier = @"identifier",
+    .location = @"location",
+    .event = @"event",
+    .invocations = @"invocations",
+    .rejections = @"rejections",
+    .timeouts = @"timeouts",
+    .totalDuration = @"totalDuration",
+    .maximumDuration = @"maximumDuration",
+    .histogram = @"histogram"
+};
+
+
+#pragma mark - Static
+
+/**
+ * @brief Upper bounds (in milliseconds) of latency histogram buckets (last bucket not bound).
+ */
+static uint64_t const kCENMiddlewareHistogramBounds[] = { 1, 5, 10, 50, 100, 500, 1000, 5000 };
+
+/**
+ * @brief Number of latency histogram buckets.
+ */
+#define CENMiddlewareHistogramBucketsCount \
+    (sizeof(kCENMiddlewareHistogramBounds) / sizeof(kCENMiddlewareHistogramBounds[0]) + 1)
+
+/**
+ * @brief Maximum number of event names for which metrics aggregated separately for each plugin
+ * identifier and location.
+ */
+static NSUInteger const kCENMiddlewareProfilerEventsLimit = 100;
+
+/**
+ * @brief Name of event under which metrics aggregated for events which exceeded
+ * \c kCENMiddlewareProfilerEventsLimit.
+ */
+static NSString * const kCENMiddlewareProfilerOverflowEvent = @"other";
+
+/**
+ * @brief Metrics aggregated for single plugin identifier, location and event.
+ */
+typedef struct CENMiddlewareStatistics {
+    uint64_t invocations;
+    uint64_t rejections;
+    uint64_t timeouts;
+    uint64_t totalDuration;
+    uint64_t maximumDuration;
+    uint64_t histogram[CENMiddlewareHistogramBucketsCount];
+} CENMiddlewareStatistics;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface CENMiddlewareProfiler () {
+
+    /**
+     * @brief Lock which is used to protect access to aggregated metrics.
+     */
+    pthread_mutex_t _metricsLock;
+}
+
+
+#pragma mark - Information
+
+/**
+ * @brief Plugin identifier mapped to location mapped to event name mapped to \a NSMutableData
+ * with \c CENMiddlewareStatistics.
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableDictionary *> *metrics;
+
+
+#pragma mark - Recording
+
+/**
+ * @brief Retrieve statistics stored for middleware.
+ *
+ * @note Should be called only while \c _metricsLock is held.
+ *
+ * @param identifier Unique identifier of plugin which provided middleware.
+ * @param location Location at which middleware has been called.
+ * @param event Normalized name of event which has been processed by middleware.
+ *
+ * @return Pointer on statistics (created if required) which can be modified.
+ */
+- (CENMiddlewareStatistics *)statisticsForMiddlewareWithIdentifier:(NSString *)identifier
+                                                        atLocation:(NSString *)location
+                                                          forEvent:(NSString *)event;
+
+
+#pragma mark - Misc
+
+/**
+ * @brief Convert host time units to nanoseconds.
+ *
+ * @param duration Duration in host time units.
+ *
+ * @return Duration in nanoseconds.
+ */
++ (uint64_t)nanosecondsFromHostTime:(uint64_t)duration;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation CENMiddlewareProfiler
+
+
+#pragma mark - Information
+
++ (uint64_t)timestamp {
+
+    return mach_absolute_time();
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)profiler {
+
+    return [self new];
+}
+
+- (instancetype)init {
+
+    if ((self = [super init])) {
+        pthread_mutex_init(&_metricsLock, NULL);
+        _metrics = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+
+#pragma mark - Recording
+
+- (void)recordMiddlewareWithIdentifier:(NSString *)identifier
+                            atLocation:(NSString *)location
+                              forEvent:(NSString *)event
+                             startedAt:(uint64_t)startTimestamp
+                              rejected:(BOOL)rejected {
+
+    uint64_t duration = [[self class] timestamp] - startTimestamp;
+    duration = [[self class] nanosecondsFromHostTime:duration];
+    uint64_t durationInMilliseconds = duration / NSEC_PER_MSEC;
+    NSUInteger bucketIdx = 0;
+
+    while (bucketIdx < CENMiddlewareHistogramBucketsCount - 1 &&
+           durationInMilliseconds >= kCENMiddlewareHistogramBounds[bucketIdx]) {
+        bucketIdx++;
+    }
+
+    pthread_mutex_lock(&_metricsLock);
+    CENMiddlewareStatistics *statistics = [self statisticsForMiddlewareWithIdentifier:identifier
+                                                                           atLocation:location
+                                                                             forEvent:event];
+    statistics->invocations++;
+    statistics->rejections += rejected ? 1 : 0;
+    statistics->totalDuration += duration;
+    statistics->maximumDuration = MAX(statistics->maximumDuration, duration);
+    statistics->histogram[bucketIdx]++;
+    pthread_mutex_unlock(&_metricsLock);
+}
+
+- (void)recordTimeoutOfMiddlewareWithIdentifier:(NSString *)identifier
+                                     atLocation:(NSString *)location
+                                       forEvent:(NSString *)event {
+    
+    pthread_mutex_lock(&_metricsLock);
+    CENMiddlewareStatistics *statistics = [self statisticsForMiddlewareWithIdentifier:identifier
+                                                                           atLocation:location
+                                                                             forEvent:event];
+    statistics->timeouts++;
+    pthread_mutex_unlock(&_metricsLock);
+}
+
+- (CENMiddlewareStatistics *)statisticsForMiddlewareWithIdentifier:(NSString *)identifier
+                                                        atLocation:(NSString *)location
+                                                          forEvent:(NSString *)event {
+    
+    NSMutableDictionary *locations = self.metrics[identifier];
+    NSString *eventName = event;
+
+    if (!locations) {
+        locations = [NSMutableDictionary new];
+        self.metrics[identifier] = locations;
+    }
+
+    NSMutableDictionary<NSString *, NSMutableData *> *events = locations[location];
+
+    if (!events) {
+        events = [NSMutableDictionary new];
+        locations[location] = events;
+    }
+
+    NSMutableData *statisticsData = events[eventName];
+
+    if (!statisticsData) {
+        NSMutableData *overflowData = events[kCENMiddlewareProfilerOverflowEvent];
+        
+        // Event names come from network, so only limited number of them tracked separately.
+        if (events.count - (overflowData ? 1 : 0) >= kCENMiddlewareProfilerEventsLimit) {
+            eventName = kCENMiddlewareProfilerOverflowEvent;
+            statisticsData = overflowData;
+        }
+    }
+
+    if (!statisticsData) {
+        statisticsData = [NSMutableData dataWithLength:sizeof(CENMiddlewareStatistics)];
+        events[eventName] = statisticsData;
+    }
+
+    return statisticsData.mutableBytes;
+}
+
+
+#pragma mark - Metrics
+
+- (NSArray<NSDictionary *> *)snapshot {
+
+    NSMutableArray<NSDictionary *> *snapshot = [NSMutableArray new];
+
+    pthread_mutex_lock(&_metricsLock);
+    for (NSString *identifier in self.metrics) {
+        NSDictionary<NSString *, NSDictionary *> *locations = self.metrics[identifier];
+
+        for (NSString *location in locations) {
+            NSDictionary<NSString *, NSMutableData *> *events = locations[location];
+
+            for (NSString *event in events) {
+                CENMiddlewareStatistics *statistics = events[event].mutableBytes;
+                NSMutableArray<NSNumber *> *histogram = [NSMutableArray new];
+
+                for (NSUInteger idx = 0; idx < CENMiddlewareHistogramBucketsCount; idx++) {
+                    [histogram addObject:@(statistics->histogram[idx])];
+                }
+
+                [snapshot addObject:@{
+                    CENMiddlewareMetrics.identifier: identifier,
+                    CENMiddlewareMetrics.location: location,
+                    CENMiddlewareMetrics.event: event,
+                    CENMiddlewareMetrics.invocations: @(statistics->invocations),
+                    CENMiddlewareMetrics.rejections: @(statistics->rejections),
+                    CENMiddlewareMetrics.timeouts: @(statistics->timeouts),
+                    CENMiddlewareMetrics.totalDuration: @(
+                        (double)statistics->totalDuration / NSEC_PER_SEC
+                    ),
+                    CENMiddlewareMetrics.maximumDuration: @(
+                        (double)statistics->maximumDuration / NSEC_PER_SEC
+                    ),
+                    CENMiddlewareMetrics.histogram: histogram
+                }];
+            }
+        }
+    }
+    pthread_mutex_unlock(&_metricsLock);
+
+    return snapshot;
+}
+
+- (void)reset {
+
+    pthread_mutex_lock(&_metricsLock);
+    [self.metrics removeAllObjects];
+    pthread_mutex_unlock(&_metricsLock);
+}
+
+
+#pragma mark - Misc
+
++ (uint64_t)nanosecondsFromHostTime:(uint64_t)duration {
+
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+
+    return duration * timebase.numer / timebase.denom;
+}
+
+
+#pragma mark - Clean up
+
+- (void)dealloc {
+
+    pthread_mutex_destroy(&_metricsLock);
+}
+
+#pragma mark -
+
+
+@end
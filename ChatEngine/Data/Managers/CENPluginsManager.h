@@ -94,6 +94,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)unregisterAllFromObjects:(CENObject *)object;
 
+/**
+ * @brief Unregister all plugins from \b {object CENObject} which may not exist anymore.
+ *
+ * @param identifier Unique identifier of \b {object CENObject} from which all plugins should be
+ *     removed.
+ *
+ * @since 0.10.0
+ */
+- (void)unregisterAllFromObjectWithIdentifier:(NSString *)identifier;
+
 
 #pragma mark - Proto plugins management
 
@@ -115,6 +125,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)setupProtoPluginsForObject:(CENObject *)object withCompletion:(dispatch_block_t)block;
 
+/**
+ * @brief Instantiate plugins from list of registered proto plugins for batch of objects.
+ *
+ * @discussion Proto plugins resolved once for each objects type and components for all objects
+ * registered within single critical section.
+ *
+ * @param objects List of \b {objects CENObject} for which proto plugins should be instantiated and
+ *     registered.
+ * @param block Instantiation and registration completion block which is called once for all
+ *     \c objects.
+ *
+ * @since 0.10.0
+ */
+- (void)setupProtoPluginsForObjects:(NSArray<CENObject *> *)objects
+                     withCompletion:(nullable dispatch_block_t)block;
+
 /**
  * @brief Register proto plugin for objects of specific \c type.
  *
@@ -170,6 +196,27 @@ NS_ASSUME_NONNULL_BEGIN
                       completion:(void(^)(BOOL rejected, NSMutableDictionary *data))block;
 
 
+#pragma mark - Metrics
+
+/**
+ * @brief Number of times when asynchronous middlewares didn't complete event processing in time.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger middlewareTimeoutsCount;
+
+/**
+ * @brief Retrieve middlewares execution metrics collected by manager.
+ *
+ * @return List of \a NSDictionary (one per plugin identifier, location and event) which use
+ * \b {CENMiddlewareMetrics} fields as keys. Empty list returned if middlewares profiling disabled
+ * in \b {CENConfiguration}.
+ *
+ * @since 0.10.0
+ */
+- (NSArray<NSDictionary *> *)middlewareMetrics;
+
+
 #pragma mark - Clean up
 
 /**
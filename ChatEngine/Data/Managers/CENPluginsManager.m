@@ -8,11 +8,19 @@
 #import "CEPExtension+Developer.h"
 #import "CEPMiddleware+Private.h"
 #import "CENChatEngine+Private.h"
+#import "CENEventEmitter+Private.h"
 #import "CEPExtension+Private.h"
 #import "CEPPlugin+Developer.h"
 #import "CEPPlugin+Private.h"
+#import "CENMiddlewareProfiler.h"
 #import "CENObject+Private.h"
+#import "CENErrorCodes.h"
+#import "CENEventAtom.h"
+#import "CENEvent.h"
 #import "CENLogMacro.h"
+#import <objc/runtime.h>
+#import <stdatomic.h>
+#import <pthread.h>
 
 
 #pragma clang diagnostic push
@@ -28,11 +36,142 @@ CEPluginDataKeys CEPluginData = {
 };
 
 
+#pragma mark - Static
+
+/**
+ * @brief Maximum number of events for which resolved middleware chains stored per object and
+ * location.
+ */
+static NSUInteger const kCENMiddlewareChainsLimit = 500;
+
+/**
+ * @brief Key under which resolved middleware chains snapshot associated with object.
+ */
+static char kCENMiddlewareChainsKey;
+
+/**
+ * @brief Key under which object's plugins state associated with object.
+ */
+static char kCENObjectPluginsKey;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
+#pragma mark - Private interface declaration
+
+/**
+ * @brief Immutable snapshot of middleware chains which has been resolved for object.
+ */
+@interface CENMiddlewareChains : NSObject
+
+
+#pragma mark - Information
+
+/**
+ * @brief Generation of object's middlewares list for which chains has been resolved.
+ *
+ * @discussion Generation increased each time when middlewares registered or removed for object.
+ */
+@property (nonatomic, readonly, assign) NSUInteger generation;
+
+/**
+ * @brief Middleware location mapped to event names mapped to list of middlewares which should be
+ * called for event at location.
+ */
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, NSDictionary *> *chains;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ * @brief Create and configure middleware chains snapshot.
+ *
+ * @param generation Generation of object's middlewares list.
+ * @param chains Middleware location mapped to event names mapped to list of middlewares.
+ *
+ * @return Configured and ready to use snapshot.
+ */
++ (instancetype)chainsWithGeneration:(NSUInteger)generation
+                              chains:(NSDictionary<NSString *, NSDictionary *> *)chains;
+
+#pragma mark -
+
+
+@end
+
+
+/**
+ * @brief Plugins state of single object.
+ *
+ * @discussion State associated with object and updated on \c resourceAccessQueue after each
+ * object's plugins modification. Extensions and plugin identifiers replaced with immutable copies,
+ * so they can be read from any thread without locks while object doesn't have pending
+ * modifications.
+ */
+@interface CENObjectPlugins : NSObject {
+    
+    /**
+     * @brief Number of scheduled object's plugins modifications which not completed yet.
+     */
+    atomic_ulong _pendingModificationsCount;
+}
+
+
+#pragma mark - Information
+
+/**
+ * @brief Plugin identifiers mapped to extensions which has been created for object.
+ */
+@property (atomic, copy) NSDictionary<NSString *, CEPExtension *> *extensions;
+
+/**
+ * @brief Identifiers of plugins which provided extension or middlewares for object.
+ */
+@property (atomic, copy) NSSet<NSString *> *identifiers;
+
+/**
+ * @brief Whether there is scheduled object's plugins modifications which not completed yet.
+ */
+@property (nonatomic, readonly, assign) BOOL hasPendingModifications;
+
+
+#pragma mark - Modification
+
+/**
+ * @brief Mark object's plugins modification as scheduled.
+ */
+- (void)beginModification;
+
+/**
+ * @brief Mark scheduled object's plugins modification as completed.
+ */
+- (void)endModification;
+
+#pragma mark -
+
+
+@end
+
+
 #pragma mark - Protected interface declaration
 
-@interface CENPluginsManager ()
+@interface CENPluginsManager () {
+    
+    /**
+     * @brief Number of times when asynchronous middlewares didn't complete event processing in
+     * time.
+     *
+     * @since 0.10.0
+     */
+    atomic_ulong _middlewareTimeoutsCount;
+    
+    /**
+     * @brief Lock which is used to serialize objects' plugins state creation.
+     *
+     * @since 0.10.0
+     */
+    pthread_mutex_t _objectPluginsLock;
+}
 
 /**
  * @brief Object which stores list of proto plugins and list of them associated with specific
@@ -45,6 +184,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) NSMutableDictionary<NSString *, NSMutableArray *> *middlewares;
 
+/**
+ * @brief Dictionary of proto plugin identifiers mapped to list of middlewares which is shared by
+ * all \b {events CENEvent}.
+ *
+ * @discussion Middlewares created once (with first event) for proto plugins which
+ * \b {CEPPlugin.sharesEventMiddlewares}, so emitted events doesn't add entries to \c middlewares.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, nullable, strong) NSMutableDictionary<NSString *, NSArray *> *eventMiddlewares;
+
 /**
  * @brief Dictionary of object identifiers mapped to dictionary where plugin identifiers mapped to
  * extensions.
@@ -57,11 +207,41 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) NSMutableDictionary<NSString *, NSHashTable *> *objects;
 
+/**
+ * @brief Whether manager has been destroyed and middlewares shouldn't be used anymore.
+ *
+ * @since 0.10.0
+ */
+@property (atomic, assign, getter = isDestroyed) BOOL destroyed;
+
 /**
  * @brief Resource access serialization queue.
  */
 @property (nonatomic, strong) dispatch_queue_t resourceAccessQueue;
 
+/**
+ * @brief Profiler which collect middlewares execution metrics.
+ *
+ * @note Profiler created only if middlewares profiling enabled in \b {CENConfiguration}.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, nullable, strong) CENMiddlewareProfiler *profiler;
+
+/**
+ * @brief Timer which is used to emit collected middlewares execution metrics.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, nullable, strong) dispatch_source_t metricsTimer;
+
+/**
+ * @brief Maximum number of seconds which asynchronous middleware can spend on event processing.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSTimeInterval middlewareTimeout;
+
 /**
  * @brief \b {CENChatEngine} which instantiated this manager.
  */
@@ -90,17 +270,112 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - Middleware
 
 /**
- * @brief Find list of middlewares which is able to handle \c event.
+ * @brief Retrieve resolved list of middlewares which is able to handle event.
+ *
+ * @discussion Resolved list read from \c object's middleware chains snapshot without locks. List
+ * resolved on \c resourceAccessQueue only if event at \c location not resolved yet for current
+ * generation of \c object's middlewares list.
+ *
+ * @param object \b {Object CENObject} for which middlewares should be found.
+ * @param location Location name on which middleware expected to handle events.
+ * @param atom Normalized name of event against which registered middlewares should be checked.
+ *
+ * @return List of middlewares which should process event.
+ *
+ * @since 0.10.0
+ */
+- (NSArray<CEPMiddleware *> *)middlewareChainForObject:(CENObject *)object
+                                            atLocation:(NSString *)location
+                                               forAtom:(CENEventAtom *)atom;
+
+/**
+ * @brief Drop middleware chains resolved for \c object.
+ *
+ * @discussion Should be called on \c resourceAccessQueue each time when list of \c object's
+ * middlewares changed.
+ *
+ * @param object \b {Object CENObject} (or receiver for shared event middlewares) for which
+ *     resolved chains should be invalidated.
+ *
+ * @since 0.10.0
+ */
+- (void)invalidateMiddlewareChainsForObject:(id)object;
+
+/**
+ * @brief Find object with which resolved middleware chains for \c object associated.
+ *
+ * @discussion \b {Events CENEvent} which doesn't have own middlewares use chains associated with
+ * manager, because they built only from shared event middlewares.
+ *
+ * @param object \b {Object CENObject} for which middleware chains will be used.
+ *
+ * @return \c object or receiver.
+ *
+ * @since 0.10.0
+ */
+- (id)middlewareChainsOwnerForObject:(CENObject *)object;
+
+/**
+ * @brief Find list of middlewares which is able to handle event.
  *
  * @param object \b {Object CENObject} for which middlewares should be found.
  * @param location Location name on which middleware expected to handle events.
- * @param event Name of event against which registered middlewares should be checked.
+ * @param atom Normalized name of event against which registered middlewares should be checked.
  *
  * @return List of middlewares which can be used to process along with
  */
 - (nullable NSArray<CEPMiddleware *> *)middlewaresForObject:(CENObject *)object
                                                  atLocation:(NSString *)location
-                                                   forEvent:(NSString *)event;
+                                                    forAtom:(CENEventAtom *)atom;
+/**
+ * @brief Pass \c payload through list of \c middlewares starting from specified index.
+ *
+ * @discussion Consecutive synchronous middlewares called in loop without continuation blocks
+ * allocation. Continuation block created only to resume processing after asynchronous middleware
+ * completion.
+ *
+ * @param middlewares List of middlewares which should process event.
+ * @param middlewareIdx Index of middleware from which processing should be started.
+ * @param location Location at which \c middlewares should be called.
+ * @param atom Normalized name of event for which \c payload should be processed.
+ * @param payload \a NSMutableDictionary which is passed from one middleware to another.
+ * @param block Processing completion block / closure which pass whether \c payload has been
+ *     rejected and processed data (if not rejected).
+ *
+ * @since 0.10.0
+ */
+- (void)runMiddlewares:(NSArray<CEPMiddleware *> *)middlewares
+             fromIndex:(NSUInteger)middlewareIdx
+            atLocation:(NSString *)location
+               forAtom:(CENEventAtom *)atom
+           withPayload:(NSMutableDictionary *)payload
+            completion:(void(^)(BOOL rejected, NSMutableDictionary *data))block;
+
+/**
+ * @brief Handle asynchronous middleware which didn't complete event processing in time.
+ *
+ * @discussion Timeout counted and reported with \c $.error.middleware.timeout event. Error is
+ * emitted and never thrown, because event processing continue with next middleware.
+ *
+ * @param middleware Middleware which didn't complete event processing.
+ * @param location Location at which \c middleware has been called.
+ * @param atom Normalized name of event which has been processed by \c middleware.
+ * @param timeout Number of seconds which \c middleware had to process event.
+ *
+ * @since 0.10.0
+ */
+- (void)handleTimeoutOfMiddleware:(CEPMiddleware *)middleware
+                       atLocation:(NSString *)location
+                          forAtom:(CENEventAtom *)atom
+                      withTimeout:(NSTimeInterval)timeout;
+
+/**
+ * @brief Emit \c $.metrics.middleware event with collected middlewares execution metrics.
+ *
+ * @since 0.10.0
+ */
+- (void)emitMiddlewareMetrics;
+
 /**
  * @brief Register \c object data pre-processing middlewares using provided plugin.
  *
@@ -121,9 +396,57 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)unregisterMiddlewaresWithIdentifier:(NSString *)identifier fromObject:(CENObject *)object;
 
+/**
+ * @brief Create shared \b {events CENEvent} middlewares from \c plugin if they not created yet.
+ *
+ * @note Should be called on \c resourceAccessQueue.
+ *
+ * @param plugin \b {Plugin CEPPlugin} which \b {CEPPlugin.sharesEventMiddlewares}.
+ * @param event \b {Event CENEvent} which is used to get middleware classes from \c plugin.
+ *
+ * @since 0.10.0
+ */
+- (void)registerEventMiddlewaresFromPlugin:(CEPPlugin *)plugin forEvent:(CENEvent *)event;
+
+/**
+ * @brief Remove shared \b {events CENEvent} middlewares.
+ *
+ * @note Should be called on \c resourceAccessQueue.
+ *
+ * @param identifier Unique identifier of proto plugin which provided middlewares.
+ *
+ * @since 0.10.0
+ */
+- (void)unregisterEventMiddlewaresWithIdentifier:(NSString *)identifier;
+
 
 #pragma mark - Plugins management
 
+/**
+ * @brief Retrieve plugins state of \c object.
+ *
+ * @param object \b {Object CENObject} for which state should be retrieved.
+ * @param shouldCreate Whether state should be created if \c object doesn't have it yet.
+ *
+ * @return Object's plugins state or \c nil if \c object doesn't have it and \c shouldCreate is
+ * \c NO.
+ *
+ * @since 0.10.0
+ */
+- (nullable CENObjectPlugins *)pluginsStateForObject:(CENObject *)object
+                                     createIfMissing:(BOOL)shouldCreate;
+
+/**
+ * @brief Update \c object's plugins state with current list of extensions and middlewares.
+ *
+ * @note Should be called on \c resourceAccessQueue.
+ *
+ * @param object \b {Object CENObject} for which plugins has been modified.
+ *
+ * @since 0.10.0
+ */
+- (void)updatePluginsStateForObject:(CENObject *)object;
+
 /**
  * @brief Register plugin's components for specified \c object.
  *
@@ -148,6 +471,56 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Interface implementation
 
+@implementation CENMiddlewareChains
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)chainsWithGeneration:(NSUInteger)generation
+                              chains:(NSDictionary<NSString *, NSDictionary *> *)chains {
+    
+    CENMiddlewareChains *middlewareChains = [self new];
+    middlewareChains->_generation = generation;
+    middlewareChains->_chains = [chains copy];
+    
+    return middlewareChains;
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation CENObjectPlugins
+
+
+#pragma mark - Information
+
+- (BOOL)hasPendingModifications {
+    
+    return atomic_load(&_pendingModificationsCount) > 0;
+}
+
+
+#pragma mark - Modification
+
+- (void)beginModification {
+    
+    atomic_fetch_add(&_pendingModificationsCount, 1);
+}
+
+- (void)endModification {
+    
+    atomic_fetch_sub(&_pendingModificationsCount, 1);
+}
+
+#pragma mark -
+
+
+@end
+
+
 @implementation CENPluginsManager
 
 
@@ -174,14 +547,40 @@ NS_ASSUME_NONNULL_END
             CEPluginData.instances: [@{} mutableCopy]
         };
 
+        _eventMiddlewares = [NSMutableDictionary new];
         _extensions = [@{} mutableCopy];
         _middlewares = [@{} mutableCopy];
         _objects = [@{} mutableCopy];
         
+        pthread_mutex_init(&_objectPluginsLock, NULL);
+        
         NSString *queue = [NSString stringWithFormat:@"com.chatengine.manager.plugins.%p", self];
         _resourceAccessQueue = dispatch_queue_create([queue UTF8String], DISPATCH_QUEUE_SERIAL);
         _chatEngine = chatEngine;
         
+        _middlewareTimeout = chatEngine.configuration.middlewareTimeout;
+        
+        if (chatEngine.configuration.shouldProfileMiddlewares) {
+            _profiler = [CENMiddlewareProfiler profiler];
+        }
+        
+        NSTimeInterval interval = chatEngine.configuration.middlewareMetricsInterval;
+        
+        if (_profiler && interval > 0.f) {
+            int64_t intervalInNanoseconds = (int64_t)(interval * NSEC_PER_SEC);
+            dispatch_time_t start = dispatch_time(DISPATCH_TIME_NOW, intervalInNanoseconds);
+            _metricsTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0,
+                                                   dispatch_get_global_queue(0, 0));
+            __weak __typeof__(self) weakSelf = self;
+            
+            dispatch_source_set_timer(_metricsTimer, start, (uint64_t)intervalInNanoseconds,
+                                      NSEC_PER_SEC);
+            dispatch_source_set_event_handler(_metricsTimer, ^{
+                [weakSelf emitMiddlewareMetrics];
+            });
+            dispatch_resume(_metricsTimer);
+        }
+        
         CELogResourceAllocation(self.chatEngine.logger,
             @"<ChatEngine::Manager::Plugins> %p instance allocation", self);
     }
@@ -237,6 +636,12 @@ NS_ASSUME_NONNULL_END
                     format:@"Parameters is empty or has unexpected data type."];
     }
     
+    CENObjectPlugins *plugins = [self pluginsStateForObject:object createIfMissing:NO];
+    
+    if (!plugins.hasPendingModifications) {
+        return self.isDestroyed ? nil : plugins.extensions[identifier];
+    }
+    
     dispatch_sync(self.resourceAccessQueue, ^{
         extension = self.extensions[object.identifier][identifier];
     });
@@ -247,17 +652,89 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Middleware
 
+- (NSArray<CEPMiddleware *> *)middlewareChainForObject:(CENObject *)object
+                                            atLocation:(NSString *)location
+                                               forAtom:(CENEventAtom *)atom {
+    
+    if (self.isDestroyed) {
+        return @[];
+    }
+    
+    NSString *eventName = atom.name;
+    id owner = [self middlewareChainsOwnerForObject:object];
+    CENMiddlewareChains *snapshot = objc_getAssociatedObject(owner, &kCENMiddlewareChainsKey);
+    __block NSArray<CEPMiddleware *> *chain = snapshot.chains[location][eventName];
+    
+    if (chain) {
+        return chain;
+    }
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        CENMiddlewareChains *current = objc_getAssociatedObject(owner, &kCENMiddlewareChainsKey);
+        NSMutableDictionary *chains = [(current.chains ?: @{}) mutableCopy];
+        NSMutableDictionary *locationChains = [(chains[location] ?: @{}) mutableCopy];
+        
+        if (!(chain = locationChains[eventName])) {
+            chain = [self middlewaresForObject:object atLocation:location forAtom:atom] ?: @[];
+            
+            if (locationChains.count >= kCENMiddlewareChainsLimit) {
+                [locationChains removeAllObjects];
+            }
+            
+            locationChains[eventName] = chain;
+            chains[location] = locationChains;
+            
+            CENMiddlewareChains *updated = nil;
+            updated = [CENMiddlewareChains chainsWithGeneration:current.generation chains:chains];
+            objc_setAssociatedObject(owner, &kCENMiddlewareChainsKey, updated,
+                                     OBJC_ASSOCIATION_RETAIN);
+        }
+    });
+    
+    return chain;
+}
+
+- (void)invalidateMiddlewareChainsForObject:(id)object {
+    
+    CENMiddlewareChains *current = objc_getAssociatedObject(object, &kCENMiddlewareChainsKey);
+    CENMiddlewareChains *updated = [CENMiddlewareChains chainsWithGeneration:current.generation + 1
+                                                                      chains:@{}];
+    
+    objc_setAssociatedObject(object, &kCENMiddlewareChainsKey, updated, OBJC_ASSOCIATION_RETAIN);
+}
+
+- (id)middlewareChainsOwnerForObject:(CENObject *)object {
+    
+    if (![object isKindOfClass:[CENEvent class]] ||
+        objc_getAssociatedObject(object, &kCENMiddlewareChainsKey)) {
+        
+        return object;
+    }
+    
+    return self;
+}
+
 - (NSArray<CEPMiddleware *> *)middlewaresForObject:(CENObject *)object
                                         atLocation:(NSString *)location
-                                          forEvent:(NSString *)event {
+                                           forAtom:(CENEventAtom *)atom {
 
-    NSMutableArray<CEPMiddleware *> *objectMiddlewares = self.middlewares[object.identifier];
+    NSMutableArray<CEPMiddleware *> *objectMiddlewares = [NSMutableArray new];
     NSMutableArray<CEPMiddleware *> *targetMiddlewares = [NSMutableArray new];
+    
+    if ([object isKindOfClass:[CENEvent class]]) {
+        NSArray *identifiers = self.protoPlugins[CEPluginData.objects][CENObjectType.event];
+        
+        for (NSString *identifier in identifiers) {
+            [objectMiddlewares addObjectsFromArray:self.eventMiddlewares[identifier] ?: @[]];
+        }
+    }
+    
+    [objectMiddlewares addObjectsFromArray:self.middlewares[object.identifier] ?: @[]];
 
     for (CEPMiddleware *middleware in objectMiddlewares) {
         NSString *middlewareLocation = [[middleware class] location];
 
-        if ([middlewareLocation isEqual:location] && [middleware registeredForEvent:event]) {
+        if ([middlewareLocation isEqual:location] && [middleware registeredForAtom:atom]) {
             [targetMiddlewares addObject:middleware];
         }
     }
@@ -278,9 +755,11 @@ NS_ASSUME_NONNULL_END
             continue;
         }
 
+        NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:location object:object];
         CEPMiddleware *middleware = [cls middlewareForObject:object
                                               withIdentifier:plugin.identifier
-                                               configuration:plugin.configuration];
+                                               configuration:plugin.configuration
+                                                      events:events];
         [middlewares addObject:middleware];
     }
     
@@ -301,6 +780,8 @@ NS_ASSUME_NONNULL_END
 
         [middleware onCreate];
     }
+    
+    [self invalidateMiddlewareChainsForObject:object];
 }
 
 - (void)unregisterMiddlewaresWithIdentifier:(NSString *)identifier fromObject:(CENObject *)object {
@@ -314,10 +795,56 @@ NS_ASSUME_NONNULL_END
         }
     }
 
+    if (!middlewaresForRemoval.count) {
+        return;
+    }
+
     [objectMiddlewares removeObjectsInArray:middlewaresForRemoval];
+    [self invalidateMiddlewareChainsForObject:object];
     [middlewaresForRemoval makeObjectsPerformSelector:@selector(onDestruct)];
 }
 
+- (void)registerEventMiddlewaresFromPlugin:(CEPPlugin *)plugin forEvent:(CENEvent *)event {
+    
+    if (self.eventMiddlewares[plugin.identifier]) {
+        return;
+    }
+    
+    NSMutableArray<CEPMiddleware *> *middlewares = [NSMutableArray new];
+    
+    for (NSString *location in CEPMiddleware.locations) {
+        Class cls = [plugin middlewareClassForLocation:location object:(id)event];
+        
+        if (!cls) {
+            continue;
+        }
+        
+        NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:location
+                                                                   object:(id)event];
+        CEPMiddleware *middleware = [cls sharedMiddlewareWithIdentifier:plugin.identifier
+                                                          configuration:plugin.configuration
+                                                                 events:events];
+        [middlewares addObject:middleware];
+    }
+    
+    self.eventMiddlewares[plugin.identifier] = middlewares;
+    [middlewares makeObjectsPerformSelector:@selector(onCreate)];
+    [self invalidateMiddlewareChainsForObject:self];
+}
+
+- (void)unregisterEventMiddlewaresWithIdentifier:(NSString *)identifier {
+    
+    NSArray<CEPMiddleware *> *middlewares = self.eventMiddlewares[identifier];
+    
+    if (!middlewares) {
+        return;
+    }
+    
+    [self.eventMiddlewares removeObjectForKey:identifier];
+    [self invalidateMiddlewareChainsForObject:self];
+    [middlewares makeObjectsPerformSelector:@selector(onDestruct)];
+}
+
 - (void)runMiddlewaresAtLocation:(NSString *)location
                         forEvent:(NSString *)event
                           object:(CENObject *)object
@@ -332,42 +859,170 @@ NS_ASSUME_NONNULL_END
                     format:@"Parameters is empty or has unexpected data type."];
     }
     
+    // Event name normalized once and passed to chain lookup, middlewares matching and profiler.
+    CENEventAtom *atom = [CENEventAtom atomForEvent:event];
     NSMutableDictionary *payloadForMiddlewares = [payload mutableCopy];
-    __block NSArray<CEPMiddleware *> *middlewares = nil;
-    __block NSUInteger currentMiddlewareIdx = 0;
+    NSArray<CEPMiddleware *> *middlewares = [self middlewareChainForObject:object
+                                                                atLocation:location
+                                                                   forAtom:atom];
+    
+    [self runMiddlewares:middlewares
+               fromIndex:0
+              atLocation:location
+                 forAtom:atom
+             withPayload:payloadForMiddlewares
+              completion:block];
+}
 
-    dispatch_sync(self.resourceAccessQueue, ^{
-        middlewares = [self middlewaresForObject:object atLocation:location forEvent:event];
-    });
+- (void)runMiddlewares:(NSArray<CEPMiddleware *> *)middlewares
+             fromIndex:(NSUInteger)middlewareIdx
+            atLocation:(NSString *)location
+               forAtom:(CENEventAtom *)atom
+           withPayload:(NSMutableDictionary *)payload
+            completion:(void(^)(BOOL rejected, NSMutableDictionary *data))block {
     
-    if (!middlewares.count) {
-        block(NO, payloadForMiddlewares);
+    NSString *event = atom.event;
+    NSUInteger middlewaresCount = middlewares.count;
+    CENMiddlewareProfiler *profiler = self.profiler;
+    
+    while (middlewareIdx < middlewaresCount) {
+        CEPMiddleware *middleware = middlewares[middlewareIdx];
+        
+        if (![[middleware class] isSynchronous]) {
+            break;
+        }
+        
+        uint64_t startTimestamp = profiler ? [CENMiddlewareProfiler timestamp] : 0;
+        BOOL rejected = [middleware processEvent:event withData:payload];
+        
+        [profiler recordMiddlewareWithIdentifier:middleware.identifier
+                                      atLocation:location
+                                        forEvent:atom.name
+                                       startedAt:startTimestamp
+                                        rejected:rejected];
         
+        if (rejected) {
+            block(YES, nil);
+            return;
+        }
+        
+        middlewareIdx++;
+    }
+    
+    if (middlewareIdx >= middlewaresCount) {
+        block(NO, payload);
         return;
     }
     
-    void(^runMiddleware)(NSMutableDictionary *, void(^)(BOOL));
-    runMiddleware = ^(NSMutableDictionary *processedPayload, void(^next)(BOOL)) {
-        [middlewares[currentMiddlewareIdx] runForEvent:event
-                                              withData:processedPayload
-                                            completion:next];
-    };
+    CEPMiddleware *middleware = middlewares[middlewareIdx];
+    NSTimeInterval timeout = [[middleware class] timeout] ?: self.middlewareTimeout;
+    uint64_t startTimestamp = profiler ? [CENMiddlewareProfiler timestamp] : 0;
+    __block atomic_bool completed = false;
+    dispatch_source_t deadline = nil;
     
-    __block __weak void(^weakNextMiddlewareEnqueue)(BOOL);
-    void(^nextMiddlewareEnqueue)(BOOL);
-    weakNextMiddlewareEnqueue = nextMiddlewareEnqueue = ^(BOOL rejected) {
-        currentMiddlewareIdx++;
+    // Late middleware may still modify its payload after deadline, so it receive own copy.
+    NSMutableDictionary *middlewarePayload = timeout > 0.f ? [payload mutableCopy] : payload;
+    
+    void(^completion)(BOOL, NSMutableDictionary *) = ^(BOOL rejected, NSMutableDictionary *data) {
+        [profiler recordMiddlewareWithIdentifier:middleware.identifier
+                                      atLocation:location
+                                        forEvent:atom.name
+                                       startedAt:startTimestamp
+                                        rejected:rejected];
         
-        if (rejected || currentMiddlewareIdx >= middlewares.count) {
-            block(rejected, rejected ? nil : payloadForMiddlewares);
+        if (rejected) {
+            block(YES, nil);
         } else {
-            runMiddleware(payloadForMiddlewares, weakNextMiddlewareEnqueue);
+            [self runMiddlewares:middlewares
+                       fromIndex:middlewareIdx + 1
+                      atLocation:location
+                         forAtom:atom
+                     withPayload:data
+                      completion:block];
         }
     };
     
-    runMiddleware(payloadForMiddlewares, nextMiddlewareEnqueue);
+    if (timeout > 0.f) {
+        dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+        int64_t timeoutInNanoseconds = (int64_t)(timeout * NSEC_PER_SEC);
+        deadline = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+        
+        dispatch_source_set_timer(deadline,
+                                  dispatch_time(DISPATCH_TIME_NOW, timeoutInNanoseconds),
+                                  DISPATCH_TIME_FOREVER,
+                                  NSEC_PER_MSEC * 10);
+        dispatch_source_set_event_handler(deadline, ^{
+            dispatch_source_cancel(deadline);
+            
+            if (atomic_exchange(&completed, true)) {
+                return;
+            }
+            
+            [self handleTimeoutOfMiddleware:middleware
+                                 atLocation:location
+                                    forAtom:atom
+                                withTimeout:timeout];
+            
+            completion(NO, payload);
+        });
+        dispatch_resume(deadline);
+    }
+    
+    [middleware runForEvent:event withData:middlewarePayload completion:^(BOOL rejected) {
+        if (deadline) {
+            dispatch_source_cancel(deadline);
+        }
+        
+        if (!atomic_exchange(&completed, true)) {
+            completion(rejected, middlewarePayload);
+        }
+    }];
+}
+
+- (void)handleTimeoutOfMiddleware:(CEPMiddleware *)middleware
+                       atLocation:(NSString *)location
+                          forAtom:(CENEventAtom *)atom
+                      withTimeout:(NSTimeInterval)timeout {
+    
+    atomic_fetch_add(&_middlewareTimeoutsCount, 1);
+    [self.profiler recordTimeoutOfMiddlewareWithIdentifier:middleware.identifier
+                                                atLocation:location
+                                                  forEvent:atom.name];
+    
+    NSString *description = [NSString stringWithFormat:@"'%@' middleware didn't process '%@' "
+                             "event within %@ seconds.", middleware.identifier, atom.event,
+                             @(timeout)];
+    NSError *error = [NSError errorWithDomain:kCENErrorDomain
+                                         code:kCENMiddlewareTimeoutError
+                                     userInfo:@{ NSLocalizedDescriptionKey: description }];
+    
+    CELogClientExceptions(self.chatEngine.logger, @"<ChatEngine::Manager::Plugins> %@",
+        description);
+    
+    [self.chatEngine emitEventLocally:@"$.error.middleware.timeout", error, nil];
+}
+
+- (void)emitMiddlewareMetrics {
+    
+    NSArray<NSDictionary *> *metrics = [self middlewareMetrics];
+    
+    if (metrics.count && !self.isDestroyed) {
+        [self.chatEngine emitEventLocally:@"$.metrics.middleware", metrics, nil];
+    }
+}
+
+
+#pragma mark - Metrics
+
+- (NSUInteger)middlewareTimeoutsCount {
+    
+    return (NSUInteger)atomic_load(&_middlewareTimeoutsCount);
 }
 
+- (NSArray<NSDictionary *> *)middlewareMetrics {
+    
+    return [self.profiler snapshot] ?: @[];
+}
 
 #pragma mark - Plugins management
 
@@ -379,11 +1034,21 @@ NS_ASSUME_NONNULL_END
         [NSException raise:NSInvalidArgumentException
                     format:@"Parameters is empty or has unexpected data type."];
     }
+    
+    CENObjectPlugins *plugins = [self pluginsStateForObject:object createIfMissing:NO];
+    
+    if (![object isKindOfClass:[CENEvent class]] && !plugins.hasPendingModifications) {
+        return !self.isDestroyed && [plugins.identifiers containsObject:identifier];
+    }
 
     dispatch_sync(self.resourceAccessQueue, ^{
         hasPlugin = self.extensions[object.identifier][identifier] != nil;
         NSMutableArray<CEPMiddleware *> *middlewares = self.middlewares[object.identifier];
         
+        if ([object isKindOfClass:[CENEvent class]]) {
+            hasPlugin = hasPlugin ?: self.eventMiddlewares[identifier] != nil;
+        }
+        
         for (CEPMiddleware *middleware in middlewares) {
             hasPlugin = hasPlugin ?: [middleware.identifier isEqual:identifier];
 
@@ -432,6 +1097,9 @@ NS_ASSUME_NONNULL_END
 
     // Remove components of previous plugin registered under same identifier.
     [self unregisterObjects:object pluginWithIdentifier:plugin.identifier];
+    
+    CENObjectPlugins *plugins = [self pluginsStateForObject:object createIfMissing:YES];
+    [plugins beginModification];
 
     dispatch_group_enter(group);
     dispatch_async(self.resourceAccessQueue, ^{
@@ -439,6 +1107,8 @@ NS_ASSUME_NONNULL_END
         [self registerMiddlewaresFromPlugin:plugin
                                   forObject:object
                                 firstInList:shouldBeFirstInList];
+        [self updatePluginsStateForObject:object];
+        [plugins endModification];
         dispatch_group_leave(group);
     });
 }
@@ -450,12 +1120,52 @@ NS_ASSUME_NONNULL_END
                     format:@"Parameters is empty or has unexpected data type."];
     }
     
+    CENObjectPlugins *plugins = [self pluginsStateForObject:object createIfMissing:YES];
+    [plugins beginModification];
+    
     dispatch_async(self.resourceAccessQueue, ^{
         [self unregisterExtensionWithIdentifier:identifier fromObject:object];
         [self unregisterMiddlewaresWithIdentifier:identifier fromObject:object];
+        [self updatePluginsStateForObject:object];
+        [plugins endModification];
     });
 }
 
+- (CENObjectPlugins *)pluginsStateForObject:(CENObject *)object
+                            createIfMissing:(BOOL)shouldCreate {
+    
+    CENObjectPlugins *plugins = objc_getAssociatedObject(object, &kCENObjectPluginsKey);
+    
+    if (plugins || !shouldCreate) {
+        return plugins;
+    }
+    
+    pthread_mutex_lock(&_objectPluginsLock);
+    plugins = objc_getAssociatedObject(object, &kCENObjectPluginsKey);
+    
+    if (!plugins) {
+        plugins = [CENObjectPlugins new];
+        objc_setAssociatedObject(object, &kCENObjectPluginsKey, plugins, OBJC_ASSOCIATION_RETAIN);
+    }
+    pthread_mutex_unlock(&_objectPluginsLock);
+    
+    return plugins;
+}
+
+- (void)updatePluginsStateForObject:(CENObject *)object {
+    
+    CENObjectPlugins *plugins = [self pluginsStateForObject:object createIfMissing:YES];
+    NSDictionary<NSString *, CEPExtension *> *extensions = self.extensions[object.identifier];
+    NSMutableSet<NSString *> *identifiers = [NSMutableSet setWithArray:extensions.allKeys ?: @[]];
+    
+    for (CEPMiddleware *middleware in self.middlewares[object.identifier]) {
+        [identifiers addObject:middleware.identifier];
+    }
+    
+    plugins.identifiers = identifiers;
+    plugins.extensions = extensions ?: @{};
+}
+
 - (void)unregisterAllFromObjects:(CENObject *)object {
     
     if (![CEPPlugin isValidObject:object]) {
@@ -479,6 +1189,25 @@ NS_ASSUME_NONNULL_END
     }
 }
 
+- (void)unregisterAllFromObjectWithIdentifier:(NSString *)identifier {
+    
+    if (![CEPPlugin isValidIdentifier:identifier]) {
+        [NSException raise:NSInvalidArgumentException
+                    format:@"Parameters is empty or has unexpected data type."];
+    }
+    
+    dispatch_async(self.resourceAccessQueue, ^{
+        NSArray<CEPExtension *> *extensions = self.extensions[identifier].allValues;
+        NSArray<CEPMiddleware *> *middlewares = [self.middlewares[identifier] copy];
+        
+        [self.extensions removeObjectForKey:identifier];
+        [self.middlewares removeObjectForKey:identifier];
+        
+        [extensions makeObjectsPerformSelector:@selector(onDestruct)];
+        [middlewares makeObjectsPerformSelector:@selector(onDestruct)];
+    });
+}
+
 
 
 #pragma mark - Proto plugins management
@@ -511,6 +1240,7 @@ NS_ASSUME_NONNULL_END
     
     NSMutableArray<CEPPlugin *> *plugins = [NSMutableArray new];
     NSString *objectType = [[object class] objectType].lowercaseString;
+    BOOL isEvent = [object isKindOfClass:[CENEvent class]];
     dispatch_group_t group = dispatch_group_create();
 
     dispatch_sync(self.resourceAccessQueue, ^{
@@ -518,6 +1248,11 @@ NS_ASSUME_NONNULL_END
         
         for (NSString *identifier in pluginIdentifiers) {
             CEPPlugin *plugin = self.protoPlugins[CEPluginData.instances][identifier];
+            
+            if (isEvent && [[plugin class] sharesEventMiddlewares]) {
+                [self registerEventMiddlewaresFromPlugin:plugin forEvent:(CENEvent *)object];
+                continue;
+            }
 
             [plugins addObject:plugin];
 
@@ -539,6 +1274,86 @@ NS_ASSUME_NONNULL_END
     dispatch_group_notify(group, queue, block);
 }
 
+- (void)setupProtoPluginsForObjects:(NSArray<CENObject *> *)objects
+                     withCompletion:(dispatch_block_t)block {
+    
+    for (CENObject *object in objects) {
+        if (![CEPPlugin isValidObject:object]) {
+            [NSException raise:NSInvalidArgumentException
+                        format:@"Parameters is empty or has unexpected data type."];
+        }
+    }
+    
+    NSMutableDictionary<NSString *, NSArray *> *typePlugins = [NSMutableDictionary new];
+    NSMutableArray<NSArray<CEPPlugin *> *> *objectsPlugins = [NSMutableArray new];
+    NSMutableArray<CENObjectPlugins *> *objectsState = [NSMutableArray new];
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        for (CENObject *object in objects) {
+            NSString *objectType = [[object class] objectType].lowercaseString;
+            BOOL isEvent = [object isKindOfClass:[CENEvent class]];
+            NSArray<CEPPlugin *> *plugins = typePlugins[objectType];
+            
+            if (!plugins) {
+                NSArray *pluginIdentifiers = self.protoPlugins[CEPluginData.objects][objectType];
+                NSMutableArray<CEPPlugin *> *resolvedPlugins = [NSMutableArray new];
+                
+                for (NSString *identifier in pluginIdentifiers) {
+                    CEPPlugin *plugin = self.protoPlugins[CEPluginData.instances][identifier];
+                    
+                    if (isEvent && [[plugin class] sharesEventMiddlewares]) {
+                        [self registerEventMiddlewaresFromPlugin:plugin
+                                                        forEvent:(CENEvent *)object];
+                        continue;
+                    }
+                    
+                    [resolvedPlugins addObject:plugin];
+                }
+                
+                plugins = resolvedPlugins;
+                typePlugins[objectType] = plugins;
+            }
+            
+            for (CEPPlugin *plugin in plugins) {
+                if (!self.objects[plugin.identifier]) {
+                    self.objects[plugin.identifier] = [NSHashTable weakObjectsHashTable];
+                }
+                
+                [self.objects[plugin.identifier] addObject:object];
+            }
+            
+            [objectsPlugins addObject:plugins];
+        }
+    });
+    
+    for (CENObject *object in objects) {
+        CENObjectPlugins *state = [self pluginsStateForObject:object createIfMissing:YES];
+        [state beginModification];
+        [objectsState addObject:state];
+    }
+    
+    dispatch_async(self.resourceAccessQueue, ^{
+        [objects enumerateObjectsUsingBlock:^(CENObject *object, NSUInteger objectIdx,
+                                              BOOL *stop) {
+            
+            for (CEPPlugin *plugin in objectsPlugins[objectIdx]) {
+                // Remove components of previous plugin registered under same identifier.
+                [self unregisterExtensionWithIdentifier:plugin.identifier fromObject:object];
+                [self unregisterMiddlewaresWithIdentifier:plugin.identifier fromObject:object];
+                [self registerExtensionFromPlugin:plugin withObject:object];
+                [self registerMiddlewaresFromPlugin:plugin forObject:object firstInList:NO];
+            }
+            
+            [self updatePluginsStateForObject:object];
+            [objectsState[objectIdx] endModification];
+        }];
+        
+        if (block) {
+            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), block);
+        }
+    });
+}
+
 - (void)registerProtoPlugin:(Class)cls
              withIdentifier:(NSString *)identifier
               configuration:(NSDictionary *)configuration
@@ -587,6 +1402,10 @@ NS_ASSUME_NONNULL_END
 
         [self.protoPlugins[CEPluginData.objects][objectType] removeObject:identifier];
         [self.protoPlugins[CEPluginData.instances] removeObjectForKey:identifier];
+        
+        if ([objectType isEqualToString:CENObjectType.event]) {
+            [self unregisterEventMiddlewaresWithIdentifier:identifier];
+        }
     });
 
     for (CENObject *object in objectsWithProto) {
@@ -611,7 +1430,20 @@ NS_ASSUME_NONNULL_END
 
             [middlewares makeObjectsPerformSelector:@selector(onDestruct)];
         }
+        
+        for (NSString *identifier in self.eventMiddlewares) {
+            NSArray<CEPMiddleware *> *middlewares = self.eventMiddlewares[identifier];
+            
+            [middlewares makeObjectsPerformSelector:@selector(onDestruct)];
+        }
 
+        if (self.metricsTimer) {
+            dispatch_source_cancel(self.metricsTimer);
+            self.metricsTimer = nil;
+        }
+        
+        self.destroyed = YES;
+        self.eventMiddlewares = nil;
         self.protoPlugins = nil;
         self.extensions = nil;
         self.middlewares = nil;
@@ -621,6 +1453,12 @@ NS_ASSUME_NONNULL_END
 
 - (void)dealloc {
     
+    if (_metricsTimer) {
+        dispatch_source_cancel(_metricsTimer);
+    }
+    
+    pthread_mutex_destroy(&_objectPluginsLock);
+    
     CELogResourceAllocation(self.chatEngine.logger,
         @"<ChatEngine::Manager::Plugins> %p instance deallocation", self);
 }
@@ -34,6 +34,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, readonly, strong) CENMe *me;
 
+/**
+ * @brief Users cache metrics.
+ *
+ * @discussion Least recently used remote users evicted from cache when it exceed
+ * \b {CENConfiguration.maximumUsersCount}.
+ *
+ * @return \a NSDictionary which use \b {CENUsersMetrics} fields as keys.
+ *
+ * @since 0.10.0
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -73,9 +85,12 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  * @brief Create list of \b {users CENUser} using provided list of identifiers.
  *
+ * @discussion Existing users looked up at once and all missing users created within single
+ * exclusive access to users storage.
+ *
  * @param uuids List of unique identifiers for which \b {users CENUser} should be created.
  *
- * @return List of \b {users CENUser} for each of provided \c uuids.
+ * @return List of \b {users CENUser} for each of provided \c uuids (in same order).
  */
 - (NSArray<CENUser *> *)createUsersWithUUID:(NSArray<NSString *> *)uuids;
 
@@ -6,18 +6,60 @@
 #import "CENUsersManager.h"
 #import "CENChatEngine+PluginsPrivate.h"
 #import "CENChatEngine+PubNubPrivate.h"
+#import "CENChatEngine+ChatPrivate.h"
 #import "CENChatEngine+Private.h"
 #import "CENObject+Private.h"
+#import "CENConfiguration.h"
+#import "CENChatsManager.h"
 #import "CENUser+Private.h"
+#import "CENStructures.h"
 #import "CENLogMacro.h"
+#import <stdatomic.h>
+#import "CENChat.h"
+#import <pthread.h>
 #import "CENMe.h"
 
 
+#pragma mark Structures
+
+/**
+ * @brief Typedef structure fields assignment.
+ */
+CENUsersMetricsKeys CENUsersMetrics = {
+    .count = @"count",
+    .capacity = @"capacity",
+    .evictions = @"evictions"
+};
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
 
-@interface CENUsersManager ()
+@interface CENUsersManager () {
+    
+    /**
+     * @brief Lock which is used to protect access to users usage information.
+     */
+    pthread_mutex_t _usageLock;
+    
+    /**
+     * @brief Number of users which has been evicted from \c usersMap.
+     */
+    atomic_ulong _evictionsCount;
+    
+    /**
+     * @brief Whether eviction of least recently used users already scheduled or not.
+     */
+    atomic_bool _evictionScheduled;
+    
+    /**
+     * @brief Value which is incremented on each user access and used to order users by usage.
+     *
+     * @note Should be accessed only while \c _usageLock is held.
+     */
+    uint64_t _usageClock;
+}
 
 
 #pragma mark - Information
@@ -42,6 +84,79 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) CENMe *me;
 
+/**
+ * @brief Map of remote user identifiers to value of \c _usageClock at moment of last access.
+ *
+ * @note Usage tracked only if \c maximumUsersCount is set.
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *usersUsage;
+
+/**
+ * @brief Maximum number of remote users which can be stored in \c usersMap (\c 0 if not limited).
+ */
+@property (nonatomic, assign) NSUInteger maximumUsersCount;
+
+
+#pragma mark - Creation
+
+/**
+ * @brief Find existing or create new \b {user CENUser} without proto plugins setup.
+ *
+ * @discussion Existing users looked up concurrently, so exclusive access to \c usersMap required
+ * only when user should be created.
+ *
+ * @param uuid Unique identifier of user which should be found or created.
+ * @param state Object with \b {user's CENUser} state which should be used with new user.
+ * @param created Pointer which is used to report whether \b {user CENUser} has been created by
+ *     this call or not.
+ *
+ * @return Existing or created \b {user CENUser} or \c nil in case if \c uuid is invalid.
+ *
+ * @since 0.10.0
+ */
+- (nullable CENUser *)userWithUUID:(NSString *)uuid
+                             state:(nullable NSDictionary *)state
+                           created:(BOOL *)created;
+
+
+#pragma mark - Eviction
+
+/**
+ * @brief Mark remote users as most recently used.
+ *
+ * @param uuids List of remote user identifiers which has been accessed.
+ *
+ * @since 0.10.0
+ */
+- (void)touchUsersWithUUID:(NSArray<NSString *> *)uuids;
+
+/**
+ * @brief Schedule eviction of least recently used users if cache exceeded \c maximumUsersCount.
+ *
+ * @since 0.10.0
+ */
+- (void)evictUsersIfRequired;
+
+/**
+ * @brief Remove least recently used users from cache until it will reach low watermark (90% of
+ * \c maximumUsersCount).
+ *
+ * @discussion Participants of connected chats won't be evicted. Users which still retained
+ * elsewhere after removal from cache will be put back, so only released users lose their plugins.
+ *
+ * @since 0.10.0
+ */
+- (void)evictLeastRecentlyUsedUsers;
+
+/**
+ * @brief Retrieve identifiers of users which is participants of connected chats.
+ *
+ * @return Set of remote user identifiers which shouldn't be evicted.
+ *
+ * @since 0.10.0
+ */
+- (NSSet<NSString *> *)participantsOfConnectedChats;
+
 #pragma mark -
 
 
@@ -79,6 +194,21 @@ NS_ASSUME_NONNULL_END
     return me;
 }
 
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+    
+    __block NSUInteger usersCount = 0;
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        usersCount = self.usersMap.count;
+    });
+    
+    return @{
+        CENUsersMetrics.count: @(usersCount),
+        CENUsersMetrics.capacity: @(self.maximumUsersCount),
+        CENUsersMetrics.evictions: @(atomic_load(&_evictionsCount))
+    };
+}
+
 
 #pragma mark - Initialization and Configuration
 
@@ -103,6 +233,11 @@ NS_ASSUME_NONNULL_END
         _resourceAccessQueue = dispatch_queue_create(cIdentifier, DISPATCH_QUEUE_CONCURRENT);
                                                       
         _usersMap = [NSMapTable strongToStrongObjectsMapTable];
+        _maximumUsersCount = chatEngine.configuration.maximumUsersCount;
+        _usersUsage = [NSMutableDictionary new];
+        pthread_mutex_init(&_usageLock, NULL);
+        atomic_init(&_evictionScheduled, false);
+        atomic_init(&_evictionsCount, 0);
         _chatEngine = chatEngine;
         
         CELogResourceAllocation(self.chatEngine.logger,
@@ -117,6 +252,104 @@ NS_ASSUME_NONNULL_END
 
 - (CENUser *)createUserWithUUID:(NSString *)uuid state:(NSDictionary *)state {
     
+    BOOL userCreated = NO;
+    CENUser *user = [self userWithUUID:uuid state:state created:&userCreated];
+    
+    if (user && userCreated) {
+        [self.chatEngine setupProtoPluginsForObject:user withCompletion:^{
+            [user onCreate];
+        }];
+        
+        [self evictUsersIfRequired];
+    }
+    
+    return user;
+}
+
+- (NSArray<CENUser *> *)createUsersWithUUID:(NSArray<NSString *> *)uuids {
+    
+    NSMutableDictionary<NSString *, CENUser *> *usersMap = [NSMutableDictionary new];
+    NSMutableArray<CENUser *> *createdUsers = [NSMutableArray new];
+    NSMutableOrderedSet<NSString *> *missingUUIDs = [NSMutableOrderedSet new];
+    NSMutableArray<NSString *> *validUUIDs = [NSMutableArray new];
+    NSString *localUUID = [self.chatEngine pubNubUUID];
+    
+    for (NSString *uuid in uuids) {
+        if ([uuid isKindOfClass:[NSString class]] && uuid.length) {
+            [validUUIDs addObject:uuid];
+        }
+    }
+    
+    if (!validUUIDs.count) {
+        return nil;
+    }
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        for (NSString *uuid in validUUIDs) {
+            BOOL isLocalUser = [uuid isEqualToString:localUUID];
+            CENUser *user = isLocalUser ? (id)self->_me : [self.usersMap objectForKey:uuid];
+            
+            if (user) {
+                usersMap[uuid] = user;
+            } else {
+                [missingUUIDs addObject:uuid];
+            }
+        }
+    });
+    
+    if (missingUUIDs.count && self.chatEngine) {
+        dispatch_barrier_sync(self.resourceAccessQueue, ^{
+            for (NSString *uuid in missingUUIDs) {
+                BOOL isLocalUser = [uuid isEqualToString:localUUID];
+                CENUser *user = isLocalUser ? (id)self->_me : [self.usersMap objectForKey:uuid];
+                
+                if (!user) {
+                    Class cls = isLocalUser ? [CENMe class] : [CENUser class];
+                    user = [cls userWithUUID:uuid state:nil chatEngine:self.chatEngine];
+                    [createdUsers addObject:user];
+                    
+                    if (isLocalUser) {
+                        self.me = (CENMe *)user;
+                    } else {
+                        [self.usersMap setObject:user forKey:uuid];
+                    }
+                }
+                
+                usersMap[uuid] = user;
+            }
+        });
+    }
+    
+    if (createdUsers.count) {
+        NSArray<NSString *> *createdUUIDs = [createdUsers valueForKey:@"uuid"];
+        
+        CELogAPICall(self.chatEngine.logger, @"<ChatEngine::API> Create %@ users: %@",
+            @(createdUsers.count), [createdUUIDs componentsJoinedByString:@", "]);
+        
+        [self.chatEngine setupProtoPluginsForObjects:createdUsers withCompletion:^{
+            [createdUsers makeObjectsPerformSelector:@selector(onCreate)];
+        }];
+    }
+    
+    [self touchUsersWithUUID:validUUIDs];
+    
+    if (createdUsers.count) {
+        [self evictUsersIfRequired];
+    }
+    
+    NSMutableArray<CENUser *> *users = [NSMutableArray arrayWithCapacity:validUUIDs.count];
+    
+    for (NSString *uuid in validUUIDs) {
+        if (usersMap[uuid]) {
+            [users addObject:usersMap[uuid]];
+        }
+    }
+    
+    return users.count ? users : nil;
+}
+
+- (CENUser *)userWithUUID:(NSString *)uuid state:(NSDictionary *)state created:(BOOL *)created {
+    
     __block BOOL userCreated = NO;
     __block CENUser *user = nil;
     
@@ -129,6 +362,20 @@ NS_ASSUME_NONNULL_END
     }
     
     BOOL isLocalUser = [uuid isEqualToString:[self.chatEngine pubNubUUID]];
+    
+    // Users almost always exist (they sent previous events), so concurrent lookup tried first and
+    // barrier taken only to create missing user.
+    dispatch_sync(self.resourceAccessQueue, ^{
+        user = isLocalUser ? (id)self->_me : [self.usersMap objectForKey:uuid];
+    });
+    
+    if (user) {
+        [self touchUsersWithUUID:@[uuid]];
+        *created = NO;
+        
+        return user;
+    }
+    
     dispatch_barrier_sync(self.resourceAccessQueue, ^{
         user = isLocalUser ? (id)self->_me : [self.usersMap objectForKey:uuid];
 
@@ -149,24 +396,13 @@ NS_ASSUME_NONNULL_END
         }
     });
     
-    if (user && userCreated) {
-        [self.chatEngine setupProtoPluginsForObject:user withCompletion:^{
-            [user onCreate];
-        }];
+    if (user) {
+        [self touchUsersWithUUID:@[uuid]];
     }
     
-    return user;
-}
-
-- (NSArray<CENUser *> *)createUsersWithUUID:(NSArray<NSString *> *)uuids {
+    *created = userCreated;
     
-    NSMutableArray *users = [NSMutableArray arrayWithCapacity:uuids.count];
-    
-    for (NSString *uuid in uuids) {
-        [users addObject:[self createUserWithUUID:uuid state:nil]];
-    }
-    
-    return users.count ? users : nil;
+    return user;
 }
 
 
@@ -182,12 +418,144 @@ NS_ASSUME_NONNULL_END
         dispatch_sync(self.resourceAccessQueue, ^{
             user = isLocalUser ? (id)self->_me : [self.usersMap objectForKey:uuid];
         });
+        
+        if (user) {
+            [self touchUsersWithUUID:@[uuid]];
+        }
     }
     
     return user;
 }
 
 
+#pragma mark - Eviction
+
+- (void)touchUsersWithUUID:(NSArray<NSString *> *)uuids {
+    
+    if (!self.maximumUsersCount) {
+        return;
+    }
+    
+    pthread_mutex_lock(&_usageLock);
+    for (NSString *uuid in uuids) {
+        self.usersUsage[uuid] = @(++_usageClock);
+    }
+    pthread_mutex_unlock(&_usageLock);
+}
+
+- (void)evictUsersIfRequired {
+    
+    if (!self.maximumUsersCount || atomic_exchange(&_evictionScheduled, true)) {
+        return;
+    }
+    
+    // Participants lookup require access to chats queues, so eviction can't be done on caller's
+    // queue (it may be one of them).
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^{
+        atomic_store(&self->_evictionScheduled, false);
+        [self evictLeastRecentlyUsedUsers];
+    });
+}
+
+- (void)evictLeastRecentlyUsedUsers {
+    
+    NSUInteger targetUsersCount = self.maximumUsersCount - self.maximumUsersCount / 10;
+    __block NSUInteger usersCount = 0;
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        usersCount = self.usersMap.count;
+    });
+    
+    if (usersCount <= self.maximumUsersCount) {
+        return;
+    }
+    
+    NSSet<NSString *> *participants = [self participantsOfConnectedChats];
+    NSArray<NSString *> *leastRecentlyUsed = nil;
+    
+    pthread_mutex_lock(&_usageLock);
+    leastRecentlyUsed = [self.usersUsage keysSortedByValueUsingSelector:@selector(compare:)];
+    pthread_mutex_unlock(&_usageLock);
+    
+    NSMutableArray<NSString *> *evictedUUIDs = [NSMutableArray new];
+    NSMutableArray<NSString *> *retainedUUIDs = [NSMutableArray new];
+    NSMutableArray<NSString *> *staleUUIDs = [NSMutableArray new];
+    
+    dispatch_barrier_sync(self.resourceAccessQueue, ^{
+        NSMapTable<NSString *, CENUser *> *candidates = [NSMapTable strongToWeakObjectsMapTable];
+        NSMutableArray<NSString *> *candidateUUIDs = [NSMutableArray new];
+        
+        @autoreleasepool {
+            for (NSString *uuid in leastRecentlyUsed) {
+                if (self.usersMap.count <= targetUsersCount) {
+                    break;
+                }
+                
+                CENUser *user = [self.usersMap objectForKey:uuid];
+                
+                if (!user) {
+                    [staleUUIDs addObject:uuid];
+                } else if (![participants containsObject:uuid]) {
+                    [candidates setObject:user forKey:uuid];
+                    [candidateUUIDs addObject:uuid];
+                    [self.usersMap removeObjectForKey:uuid];
+                }
+            }
+        }
+        
+        for (NSString *uuid in candidateUUIDs) {
+            CENUser *user = [candidates objectForKey:uuid];
+            
+            if (user) {
+                // User still retained by application or one of ChatEngine's objects.
+                [self.usersMap setObject:user forKey:uuid];
+                [retainedUUIDs addObject:uuid];
+            } else {
+                [self.chatEngine unregisterAllPluginsFromObjectWithIdentifier:uuid];
+                [evictedUUIDs addObject:uuid];
+            }
+        }
+    });
+    
+    pthread_mutex_lock(&_usageLock);
+    [self.usersUsage removeObjectsForKeys:evictedUUIDs];
+    [self.usersUsage removeObjectsForKeys:staleUUIDs];
+    pthread_mutex_unlock(&_usageLock);
+    
+    // Lazily created direct and feed chats held by chats manager and should go with evicted user.
+    if (evictedUUIDs.count) {
+        [self.chatEngine removeChatsOfUsersWithUUIDs:evictedUUIDs];
+    }
+    
+    [self touchUsersWithUUID:retainedUUIDs];
+    atomic_fetch_add(&_evictionsCount, evictedUUIDs.count);
+    
+    if (evictedUUIDs.count) {
+        CELogAPICall(self.chatEngine.logger, @"<ChatEngine::Manager::Users> Evicted %@ users.",
+            @(evictedUUIDs.count));
+    }
+}
+
+- (NSSet<NSString *> *)participantsOfConnectedChats {
+    
+    NSMutableArray<CENChat *> *chats = [self.chatEngine.chatsManager.chats.allValues mutableCopy];
+    NSMutableSet<NSString *> *participants = [NSMutableSet new];
+    CENChat *global = self.chatEngine.chatsManager.global;
+    
+    if (global) {
+        [chats addObject:global];
+    }
+    
+    for (CENChat *chat in chats) {
+        if (chat.connected) {
+            [participants addObjectsFromArray:chat.users.allKeys];
+        }
+    }
+    
+    return participants;
+}
+
+
 #pragma mark - Clean up
 
 - (void)destroy {
@@ -198,6 +566,10 @@ NS_ASSUME_NONNULL_END
         [self.usersMap removeAllObjects];
         [self->_me destruct];
         self->_me = nil;
+        
+        pthread_mutex_lock(&self->_usageLock);
+        [self.usersUsage removeAllObjects];
+        pthread_mutex_unlock(&self->_usageLock);
     });
 }
 
@@ -205,6 +577,8 @@ NS_ASSUME_NONNULL_END
     
     CELogResourceAllocation(self.chatEngine.logger,
         @"<ChatEngine::Manager::Users> %p instance deallocation", self);
+    
+    pthread_mutex_destroy(&_usageLock);
 }
 
 #pragma mark -
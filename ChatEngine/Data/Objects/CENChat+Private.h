@@ -44,6 +44,7 @@ NS_ASSUME_NONNULL_BEGIN
  * @param meta Chat metadata that will be persisted on the server and populated on creation.
  *     To use this parameter \b {CENConfiguration.enableMeta} should be set to \c YES during
  *     \b {CENChatEngine} client configuration.
+ * @param policy Policy which should be used by chat to track its participants.
  * @param chatEngine \b {CENChatEngine} client which will manage this chat instance.
  *
  * @return Configured and ready to use chat instance.
@@ -53,6 +54,7 @@ NS_ASSUME_NONNULL_BEGIN
                                 group:(NSString *)group
                               private:(BOOL)isPrivate
                              metaData:(NSDictionary *)meta
+                   participantsPolicy:(CENChatParticipantsPolicy)policy
                            chatEngine:(CENChatEngine *)chatEngine;
 
 
@@ -84,6 +86,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)wake;
 
+/**
+ * @brief Awake sleeping chat.
+ *
+ * @discussion Completion block called when chat connection handling has been scheduled or
+ * handshake failed (also called right away if chat isn't sleeping).
+ *
+ * @param block Block which should be called at the end of wake process.
+ *
+ * @since 0.10.0
+ */
+- (void)wakeWithCompletion:(nullable dispatch_block_t)block;
+
 
 #pragma mark - Participants
 
@@ -150,20 +164,49 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)handleLeave;
 
 /**
- * @brief Update list of \b {users CENUser} in this chat based on who is online now.
+ * @brief Update \b {occupancy} of chat which track only \b {CENChatParticipantsOccupancy}
+ * with number of participants who is online now.
  *
- * @param users List of users who is currently connected to this chat.
- * @param states Dictionary with user uuids mapped to their states for chat.
+ * @discussion Received value ignored if presence events changed \b {occupancy} after request
+ * for it has been issued.
+ *
+ * @param occupancy Number of users who is currently connected to this chat.
+ *
+ * @since 0.10.0
  */
-- (void)handleRemoteUsersRefresh:(NSArray<CENUser *> *)users
-                      withStates:(NSDictionary<NSString *, NSDictionary *> *)states;
+- (void)handleRemoteOccupancyRefresh:(NSUInteger)occupancy;
+
+/**
+ * @brief Update \b {occupancy} of chat which track only \b {CENChatParticipantsOccupancy}
+ * with value received along with presence event.
+ *
+ * @param occupancy Number of users who is connected to this chat after presence change.
+ *
+ * @since 0.10.0
+ */
+- (void)handleRemoteOccupancyChange:(NSUInteger)occupancy;
+
+/**
+ * @brief Handle participants list / \b {occupancy} request failure.
+ *
+ * @discussion Failed request won't be used to merge presence changes with fetched list.
+ *
+ * @since 0.10.0
+ */
+- (void)handleParticipantsRefreshFailure;
 
 /**
  * @brief Update list of \b {users CENUser} in this chat based on who is online now.
  *
+ * @discussion Received list compared with known participants, so events emitted only for users
+ * which appeared (\c $.online.here), disappeared (\c $.offline.leave) or changed their state
+ * (\c $.state). Users which presence changed after list has been requested won't be removed.
+ *
  * @param users List of users who is currently connected to this chat.
+ * @param states Dictionary with user uuids mapped to their states for chat.
  */
-- (void)handleRemoteUsersHere:(NSArray<CENUser *> *)users;
+- (void)handleRemoteUsersRefresh:(NSArray<CENUser *> *)users
+                      withStates:(NSDictionary<NSString *, NSDictionary *> *)states;
 
 /**
  * @brief Update list of \b {users CENUser} in this chat with new users.
@@ -199,6 +242,26 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)handleRemoteUsers:(NSArray<CENUser *> *)users
               stateChange:(NSDictionary<NSString *, NSDictionary *> *)states;
 
+/**
+ * @brief Update list of \b {users CENUser} in this chat with all changes from presence event.
+ *
+ * @discussion Changes reported with single \c $.online.batch event which pass \a NSDictionary
+ * with \b {CENPresenceBatch} keys.
+ *
+ * @param joinedUsers List of users which joined this chat.
+ * @param leftUsers List of users which has left chat.
+ * @param disconnectedUsers List of users which has been disconnected.
+ * @param stateChangedUsers List of users which updated their state for this chat.
+ * @param states Dictionary with user uuids mapped to their states for chat.
+ *
+ * @since 0.10.0
+ */
+- (void)handleRemoteUsersJoin:(nullable NSArray<CENUser *> *)joinedUsers
+                        leave:(nullable NSArray<CENUser *> *)leftUsers
+                   disconnect:(nullable NSArray<CENUser *> *)disconnectedUsers
+                  stateChange:(nullable NSArray<CENUser *> *)stateChangedUsers
+                   withStates:(NSDictionary<NSString *, NSDictionary *> *)states;
+
 
 #pragma mark - Misc
 
@@ -43,6 +43,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, strong) NSDictionary<NSString *, CENUser *> *users;
 
+/**
+ * @brief Policy which is used by chat to track its participants.
+ *
+ * @discussion \b {users} list stays empty for chats which track only
+ * \b {CENChatParticipantsOccupancy}.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) CENChatParticipantsPolicy participantsPolicy;
+
+/**
+ * @brief Number of users in this chat.
+ *
+ * @discussion Automatically kept in sync for chats which track only
+ * \b {CENChatParticipantsOccupancy}. Use \b {$.occupancy} event to get notified when this changes.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger occupancy;
+
 /**
  * @brief Whether client was able to connect to chat at least once.
  *
@@ -99,6 +119,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, assign) BOOL asleep;
 
+/**
+ * @brief Priority with which chat should be woken after \b {CENChatEngine.reconnect}.
+ *
+ * @discussion Chats with higher priority woken first when
+ * \b {CENConfiguration.maximumConcurrentChatWakes} limit is set.
+ *
+ * \b Default: \c 0
+ *
+ * @since 0.10.0
+ */
+@property (atomic, assign) NSInteger wakePriority;
+
 
 #pragma mark - Helpers
 
@@ -56,6 +56,17 @@ CENChatDataKeys CENChatData = {
     .meta = @"meta"
 };
 
+/**
+ * @brief Typedef structure fields assignment.
+ */
+CENPresenceBatchKeys CENPresenceBatch = {
+    .join = @"join",
+    .here = @"here",
+    .leave = @"leave",
+    .disconnect = @"disconnect",
+    .state = @"state"
+};
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -98,7 +109,50 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) NSDictionary *pendingStateChanges;
 
+/**
+ * @brief Version of participants list which is incremented with each user's presence change.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger participantsVersion;
+
+/**
+ * @brief Value of \c participantsVersion at moment when last completed participants list request
+ * has been issued.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) NSUInteger participantsRefreshVersion;
+
+/**
+ * @brief Values of \c participantsVersion at moment when each of in-flight participants list
+ * requests has been issued (in order in which requests has been sent).
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *pendingParticipantsRefreshVersions;
+
+/**
+ * @brief Map of user identifiers to \c participantsVersion at which their presence changed since
+ * last participants list refresh.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *participantsChanges;
+
+/**
+ * @brief Whether participants list is in sync with presence events or not.
+ *
+ * @discussion Chat receive all participant changes with presence events while it is connected, so
+ * full list refresh required only after chat has been disconnected.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, assign) BOOL participantsSynchronized;
+
+@property (nonatomic, assign) CENChatParticipantsPolicy participantsPolicy;
 @property (nonatomic, assign, getter=isPrivate) BOOL private;
+@property (nonatomic, assign) NSUInteger occupancy;
 @property (nonatomic, assign) BOOL hasConnected;
 @property (nonatomic, copy) NSDictionary *meta;
 @property (nonatomic, copy) NSString *channel;
@@ -125,6 +179,7 @@ NS_ASSUME_NONNULL_BEGIN
  * @param meta Chat metadata that will be persisted on the server and populated on creation.
  *     To use this parameter \b {CENConfiguration.enableMeta} should be set to \c YES during
  *     \b {CENChatEngine} client configuration.
+ * @param policy Policy which should be used by chat to track its participants.
  * @param chatEngine \b {CENChatEngine} client which will manage this chat instance.
  *
  * @return Ready to use chat instance.
@@ -134,6 +189,7 @@ NS_ASSUME_NONNULL_BEGIN
                        group:(NSString *)group
                      private:(BOOL)isPrivate
                     metaData:(NSDictionary *)meta
+          participantsPolicy:(CENChatParticipantsPolicy)policy
                   chatEngine:(CENChatEngine *)chatEngine;
 
 
@@ -156,6 +212,60 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)handleConnectionOnQueue:(BOOL)shouldUseQueue;
 
+/**
+ * @brief Update list of \b {users CENUser} in this chat with presence changes.
+ *
+ * @param joinedUsers List of users which joined this chat.
+ * @param leftUsers List of users which has left chat.
+ * @param disconnectedUsers List of users which has been disconnected.
+ * @param stateChangedUsers List of users which updated their state for this chat.
+ * @param states Dictionary with user uuids mapped to their states for chat.
+ * @param onStateChange Whether state has been received with state-change presence event or not.
+ * @param batched Whether all changes should be reported with single \c $.online.batch event or
+ *     with separate event for each user.
+ *
+ * @since 0.10.0
+ */
+- (void)handleRemoteUsersJoin:(nullable NSArray<CENUser *> *)joinedUsers
+                        leave:(nullable NSArray<CENUser *> *)leftUsers
+                   disconnect:(nullable NSArray<CENUser *> *)disconnectedUsers
+                  stateChange:(nullable NSArray<CENUser *> *)stateChangedUsers
+                   withStates:(NSDictionary<NSString *, NSDictionary *> *)states
+                onStateChange:(BOOL)onStateChange
+                      batched:(BOOL)batched;
+
+/**
+ * @brief Complete oldest in-flight participants list request.
+ *
+ * @note Should be called only on \c resourceAccessQueue.
+ *
+ * @return Value of \c participantsVersion at moment when completed request has been issued.
+ *
+ * @since 0.10.0
+ */
+- (NSUInteger)completeParticipantsRefresh;
+
+/**
+ * @brief Remove participant changes which not newer than any of in-flight participants list
+ * requests.
+ *
+ * @note Should be called only on \c resourceAccessQueue.
+ *
+ * @since 0.10.0
+ */
+- (void)removeOutdatedParticipantsChanges;
+
+/**
+ * @brief Store \c participantsVersion at which \b {user CENUser} presence in this chat changed.
+ *
+ * @note Should be called only on \c resourceAccessQueue.
+ *
+ * @param uuid Unique identifier of user which joined, left or disconnected from chat.
+ *
+ * @since 0.10.0
+ */
+- (void)handleParticipantChangeForUser:(NSString *)uuid;
+
 /**
  * @brief Handle chat disconnection / sleep completion event.
  */
@@ -174,6 +284,41 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)getUserPresenceInChat:(CENUser *)user exists:(BOOL *)exists offline:(BOOL *)offline;
 
+/**
+ * @brief Assign state received from \b PubNub to \b {user CENUser} in this chat.
+ *
+ * @param state \b {User's CENUser} state for this chat.
+ * @param user \b {User CENUser} for which state should be assigned.
+ *
+ * @return Whether \c $.state event should be emitted for \c user or not.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)assignState:(nullable NSDictionary *)state toUser:(CENUser *)user;
+
+/**
+ * @brief Notify chat's handlers about changes in participants list.
+ *
+ * @param changes Lists of \b {users CENUser} stored under \b {CENPresenceBatch} keys.
+ * @param batched Whether all changes should be reported with single \c $.online.batch event or
+ *     with separate event for each user.
+ *
+ * @since 0.10.0
+ */
+- (void)emitPresenceChanges:(NSDictionary<NSString *, NSArray<CENUser *> *> *)changes
+                    batched:(BOOL)batched;
+
+/**
+ * @brief Store new number of participants and notify chat's handlers with \c $.occupancy event.
+ *
+ * @note Should be called only on \c resourceAccessQueue.
+ *
+ * @param occupancy Number of users who is currently connected to this chat.
+ *
+ * @since 0.10.0
+ */
+- (void)updateOccupancy:(NSUInteger)occupancy;
+
 /**
  * @brief Chat serialization helper.
  *
@@ -235,6 +380,17 @@ NS_ASSUME_NONNULL_END
     return users;
 }
 
+- (NSUInteger)occupancy {
+    
+    __block NSUInteger occupancy = 0;
+    
+    dispatch_sync(self.resourceAccessQueue, ^{
+        occupancy = self->_occupancy;
+    });
+    
+    return occupancy;
+}
+
 
 #pragma mark - Initialization and Configuration
 
@@ -243,6 +399,7 @@ NS_ASSUME_NONNULL_END
                        group:(NSString *)group
                      private:(BOOL)isPrivate
                     metaData:(NSDictionary *)meta
+          participantsPolicy:(CENChatParticipantsPolicy)policy
                   chatEngine:(CENChatEngine *)chatEngine {
     
     static NSArray<NSString *> *groups;
@@ -266,6 +423,7 @@ NS_ASSUME_NONNULL_END
                                 group:group
                               private:isPrivate
                              metaData:meta
+                   participantsPolicy:policy
                            chatEngine:chatEngine];
 }
 
@@ -274,9 +432,11 @@ NS_ASSUME_NONNULL_END
                        group:(NSString *)group
                      private:(BOOL)isPrivate
                     metaData:(NSDictionary *)meta
+          participantsPolicy:(CENChatParticipantsPolicy)policy
                   chatEngine:(CENChatEngine *)chatEngine {
     
     if ((self = [super initWithChatEngine:chatEngine])) {
+        _participantsPolicy = policy;
         _group = [group copy];
         _private = isPrivate;
         _meta = [(meta ?: @{}) copy];
@@ -289,6 +449,8 @@ NS_ASSUME_NONNULL_END
         _name = [name copy];
         _usersMap = [NSMapTable strongToWeakObjectsMapTable];
         _offlineUsersMap = [NSHashTable new];
+        _pendingParticipantsRefreshVersions = [NSMutableArray new];
+        _participantsChanges = [NSMutableDictionary new];
         
         [self registerPlugin:[CENChatAugmentationPlugin class] withConfiguration:@{ }];
         [self registerPlugin:[CENSenderAugmentationPlugin class] withConfiguration:@{ }];
@@ -472,7 +634,10 @@ NS_ASSUME_NONNULL_END
 
 - (void)fetchParticipants {
     
-    [self.chatEngine fetchParticipantsForChat:self];
+    dispatch_async(self.resourceAccessQueue, ^{
+        [self.pendingParticipantsRefreshVersions addObject:@(self.participantsVersion)];
+        [self.chatEngine fetchParticipantsForChat:self];
+    });
 }
 
 
@@ -574,8 +739,20 @@ NS_ASSUME_NONNULL_END
 
 - (void)wake {
     
+    [self wakeWithCompletion:nil];
+}
+
+- (void)wakeWithCompletion:(dispatch_block_t)block {
+    
+    dispatch_block_t completion = ^{
+        if (block) {
+            block();
+        }
+    };
+    
     dispatch_async(self.resourceAccessQueue, ^{
         if (!self.asleep) {
+            completion();
             return;
         }
         
@@ -584,12 +761,14 @@ NS_ASSUME_NONNULL_END
                  [self isEqual:self.chatEngine.global]) && self.hasConnected) {
                 
                 [self handleConnection];
+                completion();
                 return;
             }
             
             [self.chatEngine handshakeChatAccess:self withCompletion:^{
                 [self handleConnection];
-            }];
+                completion();
+            } failure:completion];
         });
     });
 }
@@ -623,7 +802,7 @@ NS_ASSUME_NONNULL_END
         self.asleep = NO;
         [self.chatEngine triggerEventLocallyFrom:self event:@"$.connected", nil];
         
-        if (!chatWithParticipants || !self.isValid) {
+        if (!chatWithParticipants || !self.isValid || self.participantsSynchronized) {
             return;
         }
 
@@ -653,6 +832,8 @@ NS_ASSUME_NONNULL_END
 - (void)handleDisconnection {
     
     dispatch_async(self.resourceAccessQueue, ^{
+        // Presence events can be missed while disconnected, so list should be refreshed.
+        self.participantsSynchronized = NO;
         self.connected = NO;
         [self.chatEngine triggerEventLocallyFrom:self event:@"$.disconnected", nil];
     });
@@ -664,102 +845,264 @@ NS_ASSUME_NONNULL_END
     [self.chatEngine triggerEventLocallyFrom:self event:@"$.left", nil];
 }
 
-- (void)handleRemoteUsersRefresh:(NSArray<CENUser *> *)users withStates:(NSDictionary *)states {
+- (void)handleRemoteOccupancyRefresh:(NSUInteger)occupancy {
     
-    [self handleRemoteUsersHere:users];
-    [self handleRemoteUsers:users stateChange:states];
+    dispatch_async(self.resourceAccessQueue, ^{
+        NSUInteger refreshVersion = [self completeParticipantsRefresh];
+        [self removeOutdatedParticipantsChanges];
+        self.participantsSynchronized = YES;
+        
+        // Presence events which arrived after occupancy request carry more recent value.
+        if (self.participantsVersion == refreshVersion) {
+            [self updateOccupancy:occupancy];
+        }
+    });
 }
 
-- (void)handleRemoteUsersHere:(NSArray<CENUser *> *)users {
+- (void)handleRemoteOccupancyChange:(NSUInteger)occupancy {
     
     dispatch_async(self.resourceAccessQueue, ^{
+        self.participantsVersion++;
+        [self updateOccupancy:occupancy];
+    });
+}
+
+- (void)handleParticipantsRefreshFailure {
+    
+    dispatch_async(self.resourceAccessQueue, ^{
+        [self completeParticipantsRefresh];
+        [self removeOutdatedParticipantsChanges];
+    });
+}
+
+- (void)handleRemoteUsersRefresh:(NSArray<CENUser *> *)users withStates:(NSDictionary *)states {
+    
+    BOOL batched = self.chatEngine.configuration.shouldBatchPresenceEvents;
+    
+    dispatch_async(self.resourceAccessQueue, ^{
+        NSMutableSet<NSString *> *participants = [NSMutableSet setWithCapacity:users.count];
+        NSUInteger refreshVersion = [self completeParticipantsRefresh];
+        NSMutableArray<CENUser *> *stateChanged = [NSMutableArray new];
+        NSMutableArray<CENUser *> *here = [NSMutableArray new];
+        NSMutableArray<CENUser *> *left = [NSMutableArray new];
+        
         for (CENUser *user in users) {
             BOOL exists = NO;
             BOOL offline = NO;
             
+            [participants addObject:user.uuid];
             [self getUserPresenceInChat:user exists:&exists offline:&offline];
+            BOOL shouldEmitState = [self assignState:states[user.uuid] toUser:user];
             
             if (!exists || offline) {
-                [self.chatEngine triggerEventLocallyFrom:self event:@"$.online.here", user, nil];
+                [self handleParticipantChangeForUser:user.uuid];
+                [here addObject:user];
+            }
+            
+            if (shouldEmitState) {
+                [stateChanged addObject:user];
+            }
+        }
+        
+        for (NSString *uuid in [self.usersMap keyEnumerator].allObjects) {
+            NSUInteger changeVersion = self.participantsChanges[uuid].unsignedIntegerValue;
+            
+            // Presence events which arrived after list request are newer than received list.
+            if ([participants containsObject:uuid] ||
+                changeVersion > refreshVersion) {
+                
+                continue;
+            }
+            
+            CENUser *user = [self.usersMap objectForKey:uuid];
+            [self.usersMap removeObjectForKey:uuid];
+            [self handleParticipantChangeForUser:uuid];
+            
+            if (user) {
+                [left addObject:user];
             }
         }
+        
+        [self removeOutdatedParticipantsChanges];
+        self.participantsSynchronized = YES;
+        
+        [self emitPresenceChanges:@{
+            CENPresenceBatch.here: here,
+            CENPresenceBatch.leave: left,
+            CENPresenceBatch.state: stateChanged
+        } batched:batched];
     });
 }
 
-- (void)handleRemoteUsersJoin:(NSArray<CENUser *> *)users withStates:(NSDictionary *)states
+- (void)handleRemoteUsersJoin:(NSArray<CENUser *> *)users
+                   withStates:(NSDictionary *)states
                 onStateChange:(BOOL)onStateChange {
     
+    [self handleRemoteUsersJoin:users
+                          leave:nil
+                     disconnect:nil
+                    stateChange:nil
+                     withStates:states
+                  onStateChange:onStateChange
+                        batched:NO];
+}
+
+- (void)handleRemoteUsersLeave:(NSArray<CENUser *> *)users {
+    
+    [self handleRemoteUsersJoin:nil
+                          leave:users
+                     disconnect:nil
+                    stateChange:nil
+                     withStates:@{}
+                  onStateChange:NO
+                        batched:NO];
+}
+
+- (void)handleRemoteUsersDisconnect:(NSArray<CENUser *> *)users {
+    
+    [self handleRemoteUsersJoin:nil
+                          leave:nil
+                     disconnect:users
+                    stateChange:nil
+                     withStates:@{}
+                  onStateChange:NO
+                        batched:NO];
+}
+
+- (void)handleRemoteUsers:(NSArray<CENUser *> *)users
+              stateChange:(NSDictionary<NSString *, NSDictionary *> *)states {
+    
+    [self handleRemoteUsersJoin:nil
+                          leave:nil
+                     disconnect:nil
+                    stateChange:users
+                     withStates:states
+                  onStateChange:NO
+                        batched:NO];
+}
+
+- (void)handleRemoteUsersJoin:(NSArray<CENUser *> *)joinedUsers
+                        leave:(NSArray<CENUser *> *)leftUsers
+                   disconnect:(NSArray<CENUser *> *)disconnectedUsers
+                  stateChange:(NSArray<CENUser *> *)stateChangedUsers
+                   withStates:(NSDictionary<NSString *, NSDictionary *> *)states {
+    
+    [self handleRemoteUsersJoin:joinedUsers
+                          leave:leftUsers
+                     disconnect:disconnectedUsers
+                    stateChange:stateChangedUsers
+                     withStates:states
+                  onStateChange:(stateChangedUsers.count > 0)
+                        batched:YES];
+}
+
+- (void)handleRemoteUsersJoin:(NSArray<CENUser *> *)joinedUsers
+                        leave:(NSArray<CENUser *> *)leftUsers
+                   disconnect:(NSArray<CENUser *> *)disconnectedUsers
+                  stateChange:(NSArray<CENUser *> *)stateChangedUsers
+                   withStates:(NSDictionary<NSString *, NSDictionary *> *)states
+                onStateChange:(BOOL)onStateChange
+                      batched:(BOOL)batched {
+    
     dispatch_async(self.resourceAccessQueue, ^{
-        for (CENUser *user in users) {
+        NSMutableArray<CENUser *> *disconnected = [NSMutableArray new];
+        NSMutableArray<CENUser *> *stateChanged = [NSMutableArray new];
+        NSMutableArray<CENUser *> *joined = [NSMutableArray new];
+        NSMutableArray<CENUser *> *left = [NSMutableArray new];
+        NSMutableArray<CENUser *> *here = [NSMutableArray new];
+        
+        for (CENUser *user in joinedUsers) {
             BOOL exists = NO;
             BOOL offline = NO;
             
             [self getUserPresenceInChat:user exists:&exists offline:&offline];
+            [self handleParticipantChangeForUser:user.uuid];
             
             if (!exists && !offline) {
-                [self.chatEngine triggerEventLocallyFrom:self event:@"$.online.join", user, nil];
+                [joined addObject:user];
             } else if (offline) {
-                [self.chatEngine triggerEventLocallyFrom:self event:@"$.online.here", user, nil];
+                [here addObject:user];
             }
             
             if (!onStateChange) {
                 [user assignState:states[user.uuid] forChat:self];
             }
         }
-    });
-}
-
-- (void)handleRemoteUsersLeave:(NSArray<CENUser *> *)users {
-    
-    dispatch_async(self.resourceAccessQueue, ^{
-        for (CENUser *user in users) {
+        
+        for (CENUser *user in leftUsers) {
             [self.offlineUsersMap removeObject:user.uuid];
+            [self handleParticipantChangeForUser:user.uuid];
             
             if ([self.usersMap objectForKey:user.uuid]) {
                 [self.usersMap removeObjectForKey:user.uuid];
-                [self.chatEngine triggerEventLocallyFrom:self event:@"$.offline.leave", user, nil];
+                [left addObject:user];
             }
         }
-    });
-}
-
-- (void)handleRemoteUsersDisconnect:(NSArray<CENUser *> *)users {
-
-    dispatch_async(self.resourceAccessQueue, ^{
-        for (CENUser *user in users) {
+        
+        for (CENUser *user in disconnectedUsers) {
+            [self handleParticipantChangeForUser:user.uuid];
+            
             if ([self.usersMap objectForKey:user.uuid]) {
                 [self.offlineUsersMap addObject:user.uuid];
-                [self.chatEngine triggerEventLocallyFrom:self
-                                                   event:@"$.offline.disconnect", user, nil];
+                [disconnected addObject:user];
             }
             
             [self.usersMap removeObjectForKey:user.uuid];
         }
+        
+        for (CENUser *user in stateChangedUsers) {
+            if ([self assignState:states[user.uuid] toUser:user]) {
+                [stateChanged addObject:user];
+            }
+        }
+        
+        [self emitPresenceChanges:@{
+            CENPresenceBatch.join: joined,
+            CENPresenceBatch.here: here,
+            CENPresenceBatch.leave: left,
+            CENPresenceBatch.disconnect: disconnected,
+            CENPresenceBatch.state: stateChanged
+        } batched:batched];
     });
 }
 
-- (void)handleRemoteUsers:(NSArray<CENUser *> *)users
-              stateChange:(NSDictionary<NSString *, NSDictionary *> *)states {
+- (NSUInteger)completeParticipantsRefresh {
     
-    dispatch_async(self.resourceAccessQueue, ^{
-        for (CENUser *user in users) {
-            NSDictionary *currentUserState = [user stateForChat:self];
-            [user assignState:states[user.uuid] forChat:self];
-            NSDictionary *updatedState = [user stateForChat:self];
-            BOOL stateChanged = ![currentUserState isEqualToDictionary:updatedState];
-            BOOL isPendingState = ([user isKindOfClass:[CENMe class]] &&
-                                   [updatedState isEqualToDictionary:self.pendingStateChanges]);
-            
-            // Emit $.state event only in case if state really did changed with last assignment.
-            if (stateChanged || isPendingState) {
-                if (isPendingState) {
-                    self.pendingStateChanges = nil;
-                }
-                
-                [self.chatEngine triggerEventLocallyFrom:self event:@"$.state", user, nil];
-            }
-        };
-    });
+    NSNumber *version = self.pendingParticipantsRefreshVersions.firstObject;
+    
+    if (version) {
+        [self.pendingParticipantsRefreshVersions removeObjectAtIndex:0];
+        self.participantsRefreshVersion = version.unsignedIntegerValue;
+    }
+    
+    return self.participantsRefreshVersion;
+}
+
+- (void)removeOutdatedParticipantsChanges {
+    
+    NSNumber *pendingVersion = self.pendingParticipantsRefreshVersions.firstObject;
+    
+    if (!pendingVersion) {
+        [self.participantsChanges removeAllObjects];
+        return;
+    }
+    
+    // Changes which happened after oldest in-flight request issued required to merge its list.
+    for (NSString *uuid in self.participantsChanges.allKeys) {
+        if ([self.participantsChanges[uuid] compare:pendingVersion] != NSOrderedDescending) {
+            [self.participantsChanges removeObjectForKey:uuid];
+        }
+    }
+}
+
+- (void)handleParticipantChangeForUser:(NSString *)uuid {
+    
+    self.participantsVersion++;
+    
+    // Changes required only to merge with list which will be fetched to synchronize participants.
+    if (!self.participantsSynchronized || self.pendingParticipantsRefreshVersions.count) {
+        self.participantsChanges[uuid] = @(self.participantsVersion);
+    }
 }
 
 - (void)destruct {
@@ -846,6 +1189,72 @@ NS_ASSUME_NONNULL_END
     [self.offlineUsersMap removeObject:user.uuid];
 }
 
+- (BOOL)assignState:(NSDictionary *)state toUser:(CENUser *)user {
+    
+    NSDictionary *currentUserState = [user stateForChat:self];
+    [user assignState:state forChat:self];
+    NSDictionary *updatedState = [user stateForChat:self];
+    BOOL stateChanged = ![currentUserState isEqualToDictionary:updatedState];
+    BOOL isPendingState = ([user isKindOfClass:[CENMe class]] &&
+                           [updatedState isEqualToDictionary:self.pendingStateChanges]);
+    
+    if (isPendingState) {
+        self.pendingStateChanges = nil;
+    }
+    
+    // Emit $.state event only in case if state really did changed with last assignment.
+    return stateChanged || isPendingState;
+}
+
+- (void)emitPresenceChanges:(NSDictionary<NSString *, NSArray<CENUser *> *> *)changes
+                    batched:(BOOL)batched {
+    
+    NSArray<NSString *> *kinds = @[
+        CENPresenceBatch.join, CENPresenceBatch.here, CENPresenceBatch.leave,
+        CENPresenceBatch.disconnect, CENPresenceBatch.state
+    ];
+    
+    if (batched) {
+        NSMutableDictionary<NSString *, NSArray<CENUser *> *> *batch = [NSMutableDictionary new];
+        BOOL hasChanges = NO;
+        
+        for (NSString *kind in kinds) {
+            batch[kind] = changes[kind] ?: @[];
+            hasChanges = hasChanges || batch[kind].count;
+        }
+        
+        if (hasChanges) {
+            [self.chatEngine triggerEventLocallyFrom:self event:@"$.online.batch", batch, nil];
+        }
+        
+        return;
+    }
+    
+    NSDictionary<NSString *, NSString *> *events = @{
+        CENPresenceBatch.join: @"$.online.join",
+        CENPresenceBatch.here: @"$.online.here",
+        CENPresenceBatch.leave: @"$.offline.leave",
+        CENPresenceBatch.disconnect: @"$.offline.disconnect",
+        CENPresenceBatch.state: @"$.state"
+    };
+    
+    for (NSString *kind in kinds) {
+        for (CENUser *user in changes[kind]) {
+            [self.chatEngine triggerEventLocallyFrom:self event:events[kind], user, nil];
+        }
+    }
+}
+
+- (void)updateOccupancy:(NSUInteger)occupancy {
+    
+    if (self->_occupancy == occupancy) {
+        return;
+    }
+    
+    self.occupancy = occupancy;
+    [self.chatEngine triggerEventLocallyFrom:self event:@"$.occupancy", @(occupancy), nil];
+}
+
 - (NSDictionary * (^)(void))objectify {
     
     return ^NSDictionary * {
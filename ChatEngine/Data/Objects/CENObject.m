@@ -72,9 +72,11 @@ NS_ASSUME_NONNULL_END
         NSString *type = [[self class] objectType];
         NSString *identifier = [NSString stringWithFormat:@"com.chatengine.%@.%p", type, self];
         _resourceAccessQueue = dispatch_queue_create([identifier UTF8String], DISPATCH_QUEUE_SERIAL);
+        [CENEventEmitter disallowSynchronousDeliveryOnQueue:_resourceAccessQueue];
         _identifier = [[NSUUID UUID] UUIDString];
         _chatEngine = chatEngine;
         _valid = YES;
+        self.deliveryMode = chatEngine.configuration.eventDeliveryMode;
         
         CELogResourceAllocation(_chatEngine.logger, @"<ChatEngine::%@> Allocate instance: %@",
             NSStringFromClass([self class]), self);
@@ -104,11 +106,14 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Event emitting
 
-- (void)emitEventLocally:(NSString *)event withParameters:(NSArray *)parameters {
+- (void)emitEventAtom:(CENEventAtom *)atom withParameters:(NSArray *)parameters {
     
-    [self.chatEngine emitEventLocally:event
-                       withParameters:[@[self] arrayByAddingObjectsFromArray:parameters]];
-    [super emitEventLocally:event withParameters:parameters];
+    if ([self.chatEngine hasHandlersForAtom:atom]) {
+        [self.chatEngine emitEventAtom:atom
+                        withParameters:[@[self] arrayByAddingObjectsFromArray:parameters]];
+    }
+    
+    [super emitEventAtom:atom withParameters:parameters];
 }
 
 
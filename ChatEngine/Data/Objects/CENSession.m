@@ -55,6 +55,21 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)handleJoinToChat:(NSDictionary *)data;
 
+/**
+ * @brief Handle list of \b {chats CENChat} received during session restore.
+ *
+ * @discussion Chats which doesn't exist yet created with single batch, so proto plugins for all
+ * of them set up at once.
+ *
+ * @note Should be called on \c resourceAccessQueue.
+ *
+ * @param chats List of chat channel names which has been synchronized for \c group.
+ * @param group Name of group to which \c chats belong.
+ *
+ * @since 0.10.0
+ */
+- (void)handleRestoreOfChats:(NSArray<NSString *> *)chats inGroup:(NSString *)group;
+
 /**
  * @brief Handle chat leave event from one of user's devices.
  *
@@ -154,16 +169,9 @@ NS_ASSUME_NONNULL_END
     
     [self.chatEngine synchronizeSessionWithCompletion:^(NSString *group, NSArray *chats) {
         [self.groupsToChatsMap removeObjectForKey:group];
-        
-        for (NSString *channelName in chats) {
-            [self handleJoinToChat:@{
-                CENChatData.channel: channelName,
-                CENChatData.private: @([CENChat isPrivate:channelName]),
-                CENChatData.group: group
-            }];
-        };
 
         dispatch_async(self.resourceAccessQueue, ^{
+            [self handleRestoreOfChats:chats inGroup:group];
             [self.chatEngine triggerEventLocallyFrom:self event:@"$.group.restored", group, nil];
         });
     }];
@@ -228,6 +236,42 @@ NS_ASSUME_NONNULL_END
     });
 }
 
+- (void)handleRestoreOfChats:(NSArray<NSString *> *)chats inGroup:(NSString *)group {
+    
+    NSMutableArray<NSString *> *missingChats = [NSMutableArray new];
+    
+    if (!self.groupsToChatsMap[group]) {
+        self.groupsToChatsMap[group] = [NSMapTable strongToWeakObjectsMapTable];
+    }
+    
+    for (NSString *internalName in chats) {
+        BOOL isPrivate = [CENChat isPrivate:internalName];
+        CENChat *chat = [self.chatEngine chatWithName:internalName private:isPrivate];
+        
+        if (chat) {
+            [self.groupsToChatsMap[group] setObject:chat forKey:internalName];
+        } else if (![missingChats containsObject:internalName]) {
+            [missingChats addObject:internalName];
+        }
+    }
+    
+    if (!missingChats.count) {
+        return;
+    }
+    
+    NSArray<CENChat *> *createdChats = [self.chatEngine createChatsWithNames:missingChats
+                                                                       group:group];
+    
+    [missingChats enumerateObjectsUsingBlock:^(NSString *internalName, NSUInteger nameIdx,
+                                               BOOL *stop) {
+        
+        CENChat *chat = createdChats[nameIdx];
+        
+        [self.groupsToChatsMap[group] setObject:chat forKey:internalName];
+        [self.chatEngine triggerEventLocallyFrom:self event:@"$.chat.join", chat, nil];
+    }];
+}
+
 - (void)handleLeaveFromChat:(NSDictionary *)chatData {
     
     dispatch_async(self.resourceAccessQueue, ^{
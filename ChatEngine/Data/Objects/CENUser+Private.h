@@ -150,6 +150,9 @@ NS_ASSUME_NONNULL_BEGIN
  * @throws \b CENErrorDomain exception in following cases:
  * - passed and \b {CENChatEngine.global} chats are \c nil.
  *
+ * @discussion Concurrent calls for same \b {chat CENChat} share single state fetch request and
+ * their completion blocks called when it completes.
+ *
  * @param chat \b {Chat CENChat} for which user's state should be fetched.
  * @param block State restore completion block / closure which pass state from persistent
  *     \b PubNub K/V storage.
@@ -40,6 +40,8 @@ NS_ASSUME_NONNULL_BEGIN
  * @brief \b {Chat CENChat} which can be used to send direct (private) messages which right to
  * this user.
  *
+ * @note For remote users chat created on first access.
+ *
  * @ref d11cc0e8-3295-43f1-9210-d28fd6b7682c
  */
 @property (nonatomic, readonly, strong) CENChat *direct;
@@ -55,6 +57,8 @@ NS_ASSUME_NONNULL_BEGIN
  * @brief \b {Chat CENChat} which is used by \b {user CENUser} to publish updates (public) which
  * can be observed by anyone.
  *
+ * @note For remote users chat created on first access.
+ *
  * @ref e8b1e8fe-8213-41f0-9fbf-0572ca09a47d
  */
 @property (nonatomic, readonly, strong) CENChat *feed;
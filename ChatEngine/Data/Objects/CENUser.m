@@ -22,13 +22,20 @@
 #import "CENLogMacro.h"
 #import "CENError.h"
 #import "CENMe.h"
+#import <pthread.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
 
-@interface CENUser ()
+@interface CENUser () {
+    
+    /**
+     * @brief Lock which is used to protect lazy \c direct and \c feed chats creation.
+     */
+    pthread_mutex_t _chatsLock;
+}
 
 
 #pragma mark - Information
@@ -39,6 +46,14 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, copy) NSMutableDictionary<NSString *, NSNumber *> *restoredUserStates;
 
+/**
+ * @brief Map of chat channel names to list of completion blocks which wait for user's state fetch
+ * which is in progress for that chat.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray *> *stateRestoreBlocks;
+
 /**
  * @brief Map of chat channel names to \a NSDictionary which represent user's state on that chat.
  */
@@ -68,6 +83,32 @@ NS_ASSUME_NONNULL_END
     return CENObjectType.user;
 }
 
+- (CENChat *)direct {
+    
+    pthread_mutex_lock(&_chatsLock);
+    if (!_direct) {
+        _direct = [self.chatEngine createDirectChatForUser:self];
+    }
+    
+    CENChat *direct = _direct;
+    pthread_mutex_unlock(&_chatsLock);
+    
+    return direct;
+}
+
+- (CENChat *)feed {
+    
+    pthread_mutex_lock(&_chatsLock);
+    if (!_feed) {
+        _feed = [self.chatEngine createFeedChatForUser:self];
+    }
+    
+    CENChat *feed = _feed;
+    pthread_mutex_unlock(&_chatsLock);
+    
+    return feed;
+}
+
 - (CENChat *)defaultStateChat {
     
     return self.chatEngine.global;
@@ -128,11 +169,17 @@ NS_ASSUME_NONNULL_END
                   chatEngine:(CENChatEngine *)chatEngine {
     
     if ((self = [super initWithChatEngine:chatEngine])) {
+        pthread_mutex_init(&_chatsLock, NULL);
         _uuid = [uuid copy];
-        _direct = [self.chatEngine createDirectChatForUser:self];
-        _feed = [self.chatEngine createFeedChatForUser:self];
+        
+        // Remote users' chats rarely used, so they will be created on first access.
+        if ([self isKindOfClass:[CENMe class]]) {
+            _direct = [self.chatEngine createDirectChatForUser:self];
+            _feed = [self.chatEngine createFeedChatForUser:self];
+        }
         
         _restoredUserStates = [NSMutableDictionary new];
+        _stateRestoreBlocks = [NSMutableDictionary new];
         _states = [NSMutableDictionary new];
 
         if (state.count && ![self isKindOfClass:[CENMe class]]) {
@@ -244,24 +291,48 @@ NS_ASSUME_NONNULL_END
             return;
         }
         
+        // Concurrent events from same sender should wait for state which already requested.
+        NSMutableArray *blocks = self.stateRestoreBlocks[chat.channel];
+        BOOL fetchInProgress = blocks != nil;
+        
+        if (!fetchInProgress) {
+            blocks = [NSMutableArray new];
+            self.stateRestoreBlocks[chat.channel] = blocks;
+        }
+        
+        if (block) {
+            [blocks addObject:block];
+        }
+        
+        if (fetchInProgress) {
+            return;
+        }
+        
         [self.chatEngine fetchUserState:self
                                 forChat:chat
                          withCompletion:^(NSDictionary *restoredState) {
 
             dispatch_async(self.resourceAccessQueue, ^{
+                NSArray *completionBlocks = self.stateRestoreBlocks[chat.channel];
                 NSDictionary *currentUserState = self.states[chat.channel];
-                self.restoredUserStates[chat.channel] = @YES;
+                [self.stateRestoreBlocks removeObjectForKey:chat.channel];
+                
+                if (restoredState) {
+                    self.restoredUserStates[chat.channel] = @YES;
+                    [self assignState:restoredState forChat:chat onQueue:NO];
+                }
                 
-                [self assignState:(restoredState ?: @{}) forChat:chat onQueue:NO];
                 NSDictionary *updatedState = self.states[chat.channel];
                 
-                if (block) {
+                if (completionBlocks.count) {
                     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-                        block(self.states[chat.channel]);
+                        for (void(^completionBlock)(NSDictionary *) in completionBlocks) {
+                            completionBlock(updatedState);
+                        }
                     });
                 }
                 
-                if (![currentUserState isEqualToDictionary:updatedState]) {
+                if (restoredState && ![currentUserState isEqualToDictionary:updatedState]) {
                     [self.chatEngine triggerEventLocallyFrom:chat event:@"$.state", self, nil];
                 }
             });
@@ -284,6 +355,14 @@ NS_ASSUME_NONNULL_END
     return description;
 }
 
+
+#pragma mark - Clean up
+
+- (void)dealloc {
+    
+    pthread_mutex_destroy(&_chatsLock);
+}
+
 #pragma mark -
 
 
@@ -8,6 +8,9 @@
 #ifndef CENConstants_h
 #define CENConstants_h
 
+#import "CENStructures.h"
+
+
 #pragma mark General information constants
 
 /**
@@ -70,6 +73,45 @@ static BOOL const kCENDefaultThrowsExceptions = NO;
  */
 static BOOL const kCENDefaultEnableMeta = NO;
 
+/**
+ * @brief Mode in which \b {CENChatEngine} and it's objects deliver emitted events to handlers.
+ */
+static CENEventDeliveryMode const kCENDefaultEventDeliveryMode = CENEventDeliveryConcurrent;
+
+/**
+ * @brief Whether \b {CENChatEngine} should collect middlewares execution metrics or not.
+ */
+static BOOL const kCENDefaultProfileMiddlewares = NO;
+
+/**
+ * @brief Interval with which \b {CENChatEngine} emit collected middlewares execution metrics.
+ */
+static NSTimeInterval const kCENDefaultMiddlewareMetricsInterval = 0.f;
+
+/**
+ * @brief Maximum number of seconds which asynchronous middleware can spend on event processing
+ * (\c 0 means not limited).
+ */
+static NSTimeInterval const kCENDefaultMiddlewareTimeout = 0.f;
+
+/**
+ * @brief Maximum number of remote users which \b {CENChatEngine} keep in users cache (\c 0 means
+ * not limited).
+ */
+static NSUInteger const kCENDefaultMaximumUsersCount = 0;
+
+/**
+ * @brief Maximum number of \b {chats CENChat} which \b {CENChatEngine} wake at the same time after
+ * reconnection (\c 0 means not limited).
+ */
+static NSUInteger const kCENDefaultMaximumConcurrentChatWakes = 0;
+
+/**
+ * @brief Whether \b {CENChatEngine} should report chat presence changes with single
+ * \c $.online.batch event or not.
+ */
+static BOOL const kCENDefaultBatchPresenceEvents = NO;
+
 /**
  * @brief Maximum \b PubNub Functions response wait time.
  */
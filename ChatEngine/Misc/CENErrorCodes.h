@@ -146,5 +146,15 @@ static NSInteger const kCENPNMalformedResponseError = 3010;
  */
 static NSInteger const kCENMalformedPayloadError = 3011;
 
+
+#pragma mark - Plugins
+
+/**
+ * @brief Middleware didn't complete event processing within configured timeout.
+ *
+ * @since 0.10.0
+ */
+static NSInteger const kCENMiddlewareTimeoutError = 3012;
+
 #endif // CENErrorCodes_h
 
@@ -109,6 +109,62 @@ typedef NS_OPTIONS(NSUInteger, CENLogLevel) {
                           CENAPICallLogLevel)
 };
 
+/**
+ * @brief Enum which provides modes in which emitted events delivered to registered handlers.
+ *
+ * @since 0.10.0
+ */
+typedef NS_ENUM(NSUInteger, CENEventDeliveryMode) {
+    /**
+     * @brief Each emitted event delivered to handlers from separate block on global concurrent
+     * queue.
+     *
+     * @discussion Events emitted by same object may reach handlers in different order than they
+     * has been emitted.
+     */
+    CENEventDeliveryConcurrent = 0,
+    
+    /**
+     * @brief Events delivered to handlers in order in which they has been emitted by object.
+     *
+     * @discussion Each object use own serial queue to deliver events and all pending events
+     * delivered from single block.
+     */
+    CENEventDeliveryOrdered,
+    
+    /**
+     * @brief Events delivered to handlers synchronously on thread which emitted them.
+     *
+     * @discussion Events which has been emitted by object while it updated own data delivered in
+     * order on object's delivery queue, so handlers can read object's data (like
+     * \b {CENChat.users}) without deadlock.
+     */
+    CENEventDeliverySynchronous
+};
+
+/**
+ * @brief Enum which provides policies for \b {chat CENChat} participants tracking.
+ *
+ * @since 0.10.0
+ */
+typedef NS_ENUM(NSUInteger, CENChatParticipantsPolicy) {
+    /**
+     * @brief Each participant represented by \b {user CENUser} with state for chat.
+     *
+     * @discussion Changes in participants list reported with \c $.online.* events.
+     */
+    CENChatParticipantsUsers = 0,
+    
+    /**
+     * @brief Only number of participants tracked with \b {CENChat.occupancy}.
+     *
+     * @discussion \b {Users CENUser} won't be created for participants and their states won't be
+     * fetched. Changes in number of participants reported with \c $.occupancy event.
+     * Intended for chats with large number of participants.
+     */
+    CENChatParticipantsOccupancy
+};
+
 
 /**
  * @brief Structure which provides keys under which stored \b {CENChatEngine} data passed
@@ -169,6 +225,123 @@ typedef struct CENEventDataKeys {
 
 extern CENEventDataKeys CENEventData;
 
+/**
+ * @brief Structure which provides keys under which stored middleware execution metrics.
+ *
+ * @since 0.10.0
+ */
+typedef struct CENMiddlewareMetricsKeys {
+    /**
+     * @brief Unique identifier of plugin which provided middleware.
+     */
+    __unsafe_unretained NSString *identifier;
+    
+    /**
+     * @brief Location at which middleware has been called.
+     */
+    __unsafe_unretained NSString *location;
+    
+    /**
+     * @brief Name of event which has been processed by middleware.
+     *
+     * @note \c other used for events which exceeded limit of tracked event names.
+     */
+    __unsafe_unretained NSString *event;
+    
+    /**
+     * @brief \a NSNumber with number of times when middleware has been called.
+     */
+    __unsafe_unretained NSString *invocations;
+    
+    /**
+     * @brief \a NSNumber with number of times when middleware rejected event payload.
+     */
+    __unsafe_unretained NSString *rejections;
+    
+    /**
+     * @brief \a NSNumber with number of times when middleware didn't complete processing in time.
+     */
+    __unsafe_unretained NSString *timeouts;
+    
+    /**
+     * @brief \a NSNumber with total time (in seconds) spent by middleware to process events.
+     */
+    __unsafe_unretained NSString *totalDuration;
+    
+    /**
+     * @brief \a NSNumber with longest time (in seconds) spent by middleware to process event.
+     */
+    __unsafe_unretained NSString *maximumDuration;
+    
+    /**
+     * @brief \a NSArray with number of calls which completed within \c 1, \c 5, \c 10, \c 50,
+     * \c 100, \c 500, \c 1000, \c 5000 milliseconds and longer.
+     */
+    __unsafe_unretained NSString *histogram;
+} CENMiddlewareMetricsKeys;
+
+extern CENMiddlewareMetricsKeys CENMiddlewareMetrics;
+
+/**
+ * @brief Structure which provides keys under which stored users cache metrics.
+ *
+ * @since 0.10.0
+ */
+typedef struct CENUsersMetricsKeys {
+    /**
+     * @brief \a NSNumber with number of remote users which currently stored in cache.
+     */
+    __unsafe_unretained NSString *count;
+    
+    /**
+     * @brief \a NSNumber with maximum number of users which can be stored in cache (\c 0 if not
+     * limited).
+     */
+    __unsafe_unretained NSString *capacity;
+    
+    /**
+     * @brief \a NSNumber with number of users which has been evicted from cache.
+     */
+    __unsafe_unretained NSString *evictions;
+} CENUsersMetricsKeys;
+
+extern CENUsersMetricsKeys CENUsersMetrics;
+
+/**
+ * @brief Structure which provides keys under which stored lists of \b {users CENUser} passed with
+ * \c $.online.batch event.
+ *
+ * @since 0.10.0
+ */
+typedef struct CENPresenceBatchKeys {
+    /**
+     * @brief \a NSArray with \b {users CENUser} which joined chat.
+     */
+    __unsafe_unretained NSString *join;
+    
+    /**
+     * @brief \a NSArray with previously disconnected \b {users CENUser} which is online again.
+     */
+    __unsafe_unretained NSString *here;
+    
+    /**
+     * @brief \a NSArray with \b {users CENUser} which has left chat.
+     */
+    __unsafe_unretained NSString *leave;
+    
+    /**
+     * @brief \a NSArray with \b {users CENUser} which has been disconnected (timed out).
+     */
+    __unsafe_unretained NSString *disconnect;
+    
+    /**
+     * @brief \a NSArray with \b {users CENUser} which changed their state for chat.
+     */
+    __unsafe_unretained NSString *state;
+} CENPresenceBatchKeys;
+
+extern CENPresenceBatchKeys CENPresenceBatch;
+
 
 #pragma mark Class forward
 
@@ -46,9 +46,24 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (class, nonatomic, readonly, strong) NSArray<NSString *> *events;
 
+/**
+ * @brief \a NSArray of event names for which this middleware instance should be used.
+ *
+ * @discussion List provided by plugin's \b {CEPPlugin.eventsForMiddlewareLocation:object:} when
+ * middleware has been created or class' \c events if plugin didn't provide one. List compiled into
+ * event filter during middleware initialization, so different instances of same middleware class
+ * can handle different events.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, copy) NSArray<NSString *> *events;
+
 /**
  * @brief \b {Object CENObject} subclass instance for which middleware has been associated.
  *
+ * @note \c nil for middlewares which is shared by all \b {events CENEvent} (when plugin
+ * \b {CEPPlugin.sharesEventMiddlewares}).
+ *
  * @since 0.9.3
  *
  * @ref d25d3466-bd98-47c3-969e-db2abcc25806
@@ -69,6 +84,33 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (class, nonatomic, readonly, strong) NSString *location;
 
+/**
+ * @brief Whether middleware always calls completion block before
+ * \c runForEvent:withData:completion: returns.
+ *
+ * @discussion Synchronous middlewares called by \b {CENChatEngine} in tight loop without
+ * continuation blocks allocation. Subclass should override this property only if completion block
+ * never called asynchronously (from another queue or as result of network request).
+ *
+ * @note Default value is \c NO.
+ *
+ * @since 0.10.0
+ */
+@property (class, nonatomic, readonly, getter = isSynchronous) BOOL synchronous;
+
+/**
+ * @brief Maximum number of seconds which asynchronous middleware can spend on event processing.
+ *
+ * @discussion When time runs out, \b {CENChatEngine} continue event processing with next
+ * middleware and completion block call from this middleware will be ignored.
+ *
+ * @note Default value is \c 0 which mean what \b {CENConfiguration.middlewareTimeout} should be
+ * used.
+ *
+ * @since 0.10.0
+ */
+@property (class, nonatomic, readonly, assign) NSTimeInterval timeout;
+
 /**
  * @brief Unique identifier of plugin which instantiated this middleware.
  *
@@ -85,9 +127,14 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * @param events \a NSArray of event names for which middleware should be used.
  *
+ * @deprecated 0.10.0
+ *
  * @ref 9b26b53a-558c-4d4e-b914-c6bc6b99b97f
  */
-+ (void)replaceEventsWith:(NSArray<NSString *> *)events;
++ (void)replaceEventsWith:(NSArray<NSString *> *)events
+    DEPRECATED_MSG_ATTRIBUTE("This method deprecated since 0.10.0. Replaced list affects "
+                             "middlewares created by all plugin instances. Use CEPPlugin's "
+                             "-eventsForMiddlewareLocation:object: instead.");
 
 
 #pragma mark - Call
@@ -110,6 +157,24 @@ NS_ASSUME_NONNULL_BEGIN
            withData:(NSMutableDictionary *)data
          completion:(void(^)(BOOL rejected))block;
 
+/**
+ * @brief Run synchronous middleware's code which will update \c data as it required by it's logic.
+ *
+ * @discussion Used by \b {CENChatEngine} for middlewares which declared themselves as
+ * \c synchronous. Default implementation call \c runForEvent:withData:completion: with
+ * non-escaping completion block, so subclasses doesn't need to override it.
+ *
+ * @param event Name of event for which middleware should adjust \c data content.
+ * @param data \a NSMutableDictionary which contain information about event and result of previous
+ *     middleware execution.
+ *
+ * @return Whether middleware rejected received data (causes further processing termination) or
+ * not.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)processEvent:(NSString *)event withData:(NSMutableDictionary *)data;
+
 
 #pragma mark - Handlers
 
@@ -6,6 +6,11 @@
 #import "CEPMiddleware+Developer.h"
 
 
+#pragma mark Class forward
+
+@class CENEventAtom;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Private interface declaration
@@ -22,6 +27,35 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, readonly, copy) NSString *identifier;
 
+/**
+ * @brief Number of event names for which match results currently stored.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger matchCacheSize;
+
+/**
+ * @brief Number of \b {-registeredForEvent:} calls which has been answered with stored match
+ * result.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger matchCacheHits;
+
+/**
+ * @brief Number of \b {-registeredForEvent:} calls which required event name match.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger matchCacheMisses;
+
+/**
+ * @brief Number of match results which has been removed to make room for new event names.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, readonly, assign) NSUInteger matchCacheEvictions;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -38,18 +72,74 @@ NS_ASSUME_NONNULL_BEGIN
                      withIdentifier:(NSString *)identifier
                       configuration:(nullable NSDictionary *)configuration;
 
+/**
+ * @brief Create and configure middleware instance which handle specified list of events.
+ *
+ * @param object \b {Object CENObject} for which middleware will be created.
+ * @param identifier Unique identifier of plugin which provided this middleware.
+ * @param configuration \a NSDictionary which is passed during plugin registration.
+ * @param events List of event names for which middleware should be used. Class' \c events will be
+ *     used if \c nil passed.
+ *
+ * @return Configured and ready to use plugin instance.
+ *
+ * @since 0.10.0
+ */
++ (instancetype)middlewareForObject:(CENObject *)object
+                     withIdentifier:(NSString *)identifier
+                      configuration:(nullable NSDictionary *)configuration
+                             events:(nullable NSArray<NSString *> *)events;
+
+/**
+ * @brief Create and configure middleware instance which will be shared by all
+ * \b {events CENEvent} of \b {CENChatEngine} instance.
+ *
+ * @param identifier Unique identifier of plugin which provided this middleware.
+ * @param configuration \a NSDictionary which is passed during plugin registration.
+ * @param events List of event names for which middleware should be used. Class' \c events will be
+ *     used if \c nil passed.
+ *
+ * @return Configured and ready to use plugin instance which doesn't have \c object.
+ *
+ * @since 0.10.0
+ */
++ (instancetype)sharedMiddlewareWithIdentifier:(NSString *)identifier
+                                 configuration:(nullable NSDictionary *)configuration
+                                        events:(nullable NSArray<NSString *> *)events;
+
 
 #pragma mark - Events
 
 /**
  * @brief Check whether middleware can be launched for \c event or not.
  *
+ * @discussion Match results stored in bounded cache, so same event name matched only once while
+ * it is in cache. Match performed against event filter which has been compiled from middleware's
+ * \c events during initialization.
+ *
+ * @note Method is not thread-safe and should be called from plugins manager resources access
+ * queue.
+ *
  * @param event Name of event against which middleware should be checked.
  *
  * @return Whether middleware can be launched or not.
  */
 - (BOOL)registeredForEvent:(NSString *)event;
 
+/**
+ * @brief Check whether middleware can be launched for event represented by \c atom or not.
+ *
+ * @note Method is not thread-safe and should be called from plugins manager resources access
+ * queue.
+ *
+ * @param atom Normalized name of event against which middleware should be checked.
+ *
+ * @return Whether middleware can be launched or not.
+ *
+ * @since 0.10.0
+ */
+- (BOOL)registeredForAtom:(CENEventAtom *)atom;
+
 #pragma mark -
 
 
@@ -5,6 +5,7 @@
  */
 #import "CEPMiddleware+Private.h"
 #import <CENChatEngine/CENEvent.h>
+#import "CENEventAtom.h"
 #import <objc/runtime.h>
 
 
@@ -19,6 +20,14 @@ CEPMiddlewareLocations CEPMiddlewareLocation = {
 };
 
 
+#pragma mark - Static
+
+/**
+ * @brief Maximum number of event names for which middleware stores match results.
+ */
+static NSUInteger const kCEPMiddlewareMatchCacheLimit = 1000;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Protected interface declaration
@@ -29,14 +38,47 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - Information
 
 /**
- * @brief List of events which can't be handled by middleware (after verification).
+ * @brief Event names mapped to results of check whether middleware can handle them or not.
+ *
+ * @discussion Number of stored results bound by \c kCEPMiddlewareMatchCacheLimit.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *matchCache;
+
+/**
+ * @brief Ring of event names in order in which they has been stored in \c matchCache.
+ *
+ * @discussion When cache is full, oldest event name from ring is used to make room for new one.
+ *
+ * @since 0.10.0
  */
-@property (nonatomic, strong) NSMutableArray<NSString *> *ignoredEvents;
+@property (nonatomic, strong) NSMutableArray<NSString *> *matchCacheRing;
 
 /**
- * @brief List of events for which middleware already verified ability to handle them.
+ * @brief Index in \c matchCacheRing at which oldest stored event name is stored.
+ *
+ * @since 0.10.0
  */
-@property (nonatomic, strong) NSMutableArray<NSString *> *checkedEvents;
+@property (nonatomic, assign) NSUInteger matchCacheRingIdx;
+
+@property (nonatomic, assign) NSUInteger matchCacheHits;
+@property (nonatomic, assign) NSUInteger matchCacheMisses;
+@property (nonatomic, assign) NSUInteger matchCacheEvictions;
+
+/**
+ * @brief Names of events (without wildcards) for which middleware should be used.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSSet<NSString *> *exactEvents;
+
+/**
+ * @brief Components of event names with wildcards against which event path should be matched.
+ *
+ * @since 0.10.0
+ */
+@property (nonatomic, strong) NSArray<NSArray<NSString *> *> *eventPatterns;
 
 /**
  * @brief Whether middleware is able to handle any events or not.
@@ -44,6 +86,7 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign, getter=shouldHandleAllEvents) BOOL handleAllEvents;
 
 @property (nonatomic, nullable, copy) NSDictionary *configuration;
+@property (nonatomic, copy) NSArray<NSString *> *events;
 @property (nonatomic, nullable, weak) CENObject *object;
 @property (nonatomic, copy) NSString *identifier;
 
@@ -53,15 +96,45 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  * @brief Initialize middleware instance.
  *
- * @param object \b {Object CENObject} for which middleware will be created.
+ * @param object \b {Object CENObject} for which middleware will be created or \c nil for shared
+ *     middleware.
  * @param identifier Unique identifier of plugin which provided this middleware.
  * @param configuration \a NSDictionary which is passed during plugin registration.
+ * @param events List of event names for which middleware should be used.
  *
  * @return Initialized and ready to use plugin instance.
  */
-- (instancetype)initForObject:(CENObject *)object
+- (instancetype)initForObject:(nullable CENObject *)object
                withIdentifier:(NSString *)identifier
-                configuration:(nullable NSDictionary *)configuration;
+                configuration:(nullable NSDictionary *)configuration
+                       events:(NSArray<NSString *> *)events;
+
+
+#pragma mark - Events
+
+/**
+ * @brief Compile list of event names into filter which is used by \c -registeredForEvent:.
+ *
+ * @discussion Event names without wildcards stored in \c exactEvents set, so they checked in
+ * constant time. Only event names with wildcards require path components match.
+ *
+ * @param events List of event names for which middleware should be used.
+ *
+ * @since 0.10.0
+ */
+- (void)compileEventFilterFromEvents:(NSArray<NSString *> *)events;
+
+/**
+ * @brief Store result of check whether middleware can handle \c event or not.
+ *
+ * @discussion If cache is full, result stored for oldest event will be evicted.
+ *
+ * @param match Whether middleware can handle \c event or not.
+ * @param event Lowercased name of event for which result should be stored.
+ *
+ * @since 0.10.0
+ */
+- (void)storeMatch:(BOOL)match forEvent:(NSString *)event;
 
 #pragma mark -
 
@@ -98,6 +171,16 @@ NS_ASSUME_NONNULL_END
     return nil;
 }
 
++ (BOOL)isSynchronous {
+    
+    return NO;
+}
+
++ (NSTimeInterval)timeout {
+    
+    return 0.f;
+}
+
 + (NSArray<NSString *> *)events {
     
     NSAssert(0, @"%s should be implemented by subclass", __PRETTY_FUNCTION__);
@@ -133,6 +216,17 @@ NS_ASSUME_NONNULL_END
                      withIdentifier:(NSString *)identifier
                       configuration:(NSDictionary *)configuration {
     
+    return [self middlewareForObject:object
+                      withIdentifier:identifier
+                       configuration:configuration
+                              events:nil];
+}
+
++ (instancetype)middlewareForObject:(CENObject *)object
+                     withIdentifier:(NSString *)identifier
+                      configuration:(NSDictionary *)configuration
+                             events:(NSArray<NSString *> *)events {
+    
     BOOL isValidObject = ([object isKindOfClass:[CENObject class]] ||
                           [object isKindOfClass:[CENEvent class]]);
     
@@ -144,23 +238,52 @@ NS_ASSUME_NONNULL_END
         configuration = @{};
     }
     
+    if (![events isKindOfClass:[NSArray class]]) {
+        events = [self events];
+    }
+    
     return [[self alloc] initForObject:object
                         withIdentifier:identifier
-                         configuration:configuration];
+                         configuration:configuration
+                                events:events];
+}
+
++ (instancetype)sharedMiddlewareWithIdentifier:(NSString *)identifier
+                                 configuration:(NSDictionary *)configuration
+                                        events:(NSArray<NSString *> *)events {
+    
+    if (![identifier isKindOfClass:[NSString class]] || !identifier.length) {
+        return nil;
+    }
+    
+    if (!configuration || ![configuration isKindOfClass:[NSDictionary class]]) {
+        configuration = @{};
+    }
+    
+    if (![events isKindOfClass:[NSArray class]]) {
+        events = [self events];
+    }
+    
+    return [[self alloc] initForObject:nil
+                        withIdentifier:identifier
+                         configuration:configuration
+                                events:events];
 }
 
 - (instancetype)initForObject:(CENObject *)object
                withIdentifier:(NSString *)identifier
-                configuration:(NSDictionary *)configuration {
+                configuration:(NSDictionary *)configuration
+                       events:(NSArray<NSString *> *)events {
     
     if ((self = [super init])) {
-        _ignoredEvents = [NSMutableArray new];
-        _checkedEvents = [NSMutableArray new];
+        _matchCache = [NSMutableDictionary new];
+        _matchCacheRing = [NSMutableArray new];
         _configuration = configuration;
         _identifier = identifier;
+        _events = [events copy];
         _object = object;
         
-        _handleAllEvents = [[[self class] events] containsObject:@"*"];
+        [self compileEventFilterFromEvents:_events];
     }
     
     return self;
@@ -176,49 +299,113 @@ NS_ASSUME_NONNULL_END
     block(NO);
 }
 
+- (BOOL)processEvent:(NSString *)event withData:(NSMutableDictionary *)data {
+    
+    __block BOOL rejected = NO;
+    
+    [self runForEvent:event withData:data completion:^(BOOL isRejected) {
+        rejected = isRejected;
+    }];
+    
+    return rejected;
+}
+
 
 #pragma mark - Events
 
+- (NSUInteger)matchCacheSize {
+    
+    return self.matchCache.count;
+}
+
 - (BOOL)registeredForEvent:(NSString *)event {
     
-    NSArray<NSString *> *events = [[self class] events];
-    BOOL registeredForEvent = NO;
+    if (self.shouldHandleAllEvents) {
+        return YES;
+    }
     
-    if ([self.checkedEvents containsObject:event]) {
-        registeredForEvent = ![self.ignoredEvents containsObject:event];
-    } else if (self.shouldHandleAllEvents) {
-        registeredForEvent = YES;
-    } else {
-        NSArray<NSString *> *eventComponents = [event componentsSeparatedByString:@"."];
-        BOOL eventAsPath = eventComponents.count > 1;
+    CENEventAtom *eventAtom = [CENEventAtom atomForEvent:event];
+    
+    return eventAtom ? [self registeredForAtom:eventAtom] : NO;
+}
+
+- (BOOL)registeredForAtom:(CENEventAtom *)atom {
+    
+    if (self.shouldHandleAllEvents) {
+        return YES;
+    }
+    
+    NSNumber *cachedMatch = self.matchCache[atom.name];
+    
+    if (cachedMatch) {
+        self.matchCacheHits++;
         
-        for (NSString *rEvent in events) {
-            if (!eventAsPath) {
-                registeredForEvent = [event isEqualToString:rEvent];
-            } else {
-                NSArray<NSString *> *rEventComponents = [rEvent componentsSeparatedByString:@"."];
-
-                if (rEventComponents.count > eventComponents.count) {
-                    registeredForEvent = NO;
-                } else {
-                    registeredForEvent = [self partlyMatchEvent:eventComponents
-                                                        toEvent:rEventComponents];
-                }
+        return cachedMatch.boolValue;
+    }
+    
+    NSArray<NSString *> *eventComponents = atom.components;
+    BOOL registeredForEvent = [self.exactEvents containsObject:atom.name];
+    self.matchCacheMisses++;
+    
+    if (!registeredForEvent && eventComponents.count > 1) {
+        for (NSArray<NSString *> *rEventComponents in self.eventPatterns) {
+            if (rEventComponents.count > eventComponents.count) {
+                continue;
             }
             
+            registeredForEvent = [self partlyMatchEvent:eventComponents toEvent:rEventComponents];
+            
             if (registeredForEvent) {
                 break;
             }
         }
+    }
+    
+    [self storeMatch:registeredForEvent forEvent:atom.name];
+    
+    return registeredForEvent;
+}
+
+- (void)compileEventFilterFromEvents:(NSArray<NSString *> *)events {
+    
+    NSMutableArray<NSArray<NSString *> *> *eventPatterns = [NSMutableArray new];
+    NSMutableSet<NSString *> *exactEvents = [NSMutableSet new];
+    
+    for (NSString *rEvent in events) {
+        CENEventAtom *rEventAtom = [CENEventAtom atomForEvent:rEvent];
+        
+        if (!rEventAtom) {
+            continue;
+        }
+        
+        NSArray<NSString *> *rEventComponents = rEventAtom.components;
+        
+        if ([rEventComponents containsObject:@"*"] || [rEventComponents containsObject:@"**"]) {
+            [eventPatterns addObject:rEventComponents];
+        }
         
-        [self.checkedEvents addObject:event];
+        [exactEvents addObject:rEventAtom.name];
     }
     
-    if (!registeredForEvent) {
-        [self.ignoredEvents addObject:event];
+    self.handleAllEvents = [events containsObject:@"*"];
+    self.eventPatterns = eventPatterns;
+    self.exactEvents = exactEvents;
+}
+
+- (void)storeMatch:(BOOL)match forEvent:(NSString *)event {
+    
+    if (self.matchCacheRing.count < kCEPMiddlewareMatchCacheLimit) {
+        [self.matchCacheRing addObject:event];
+    } else {
+        NSUInteger ringIdx = self.matchCacheRingIdx;
+        
+        [self.matchCache removeObjectForKey:self.matchCacheRing[ringIdx]];
+        self.matchCacheRing[ringIdx] = event;
+        self.matchCacheRingIdx = (ringIdx + 1) % kCEPMiddlewareMatchCacheLimit;
+        self.matchCacheEvictions++;
     }
     
-    return registeredForEvent;
+    self.matchCache[event] = @(match);
 }
 
 - (BOOL)partlyMatchEvent:(NSArray<NSString *> *)tEvent toEvent:(NSArray<NSString *> *)rEvent {
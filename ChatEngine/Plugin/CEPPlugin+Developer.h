@@ -43,6 +43,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (class, nonatomic, readonly, copy) NSString *identifier;
 
+/**
+ * @brief Whether plugin's middlewares for \b {events CENEvent} doesn't store any per-event state.
+ *
+ * @discussion Single instance of each such middleware created per \b {CENChatEngine} and shared by
+ * all emitted \b {events CENEvent}, so registration doesn't allocate middlewares for each emitted
+ * event. Shared middleware's \b {CEPMiddleware.object} is \c nil and information about event
+ * should be taken from passed payload.
+ *
+ * @note Interface extensions for \b {events CENEvent} not created for such plugins.
+ *
+ * \b Default: \c NO
+ *
+ * @since 0.10.0
+ */
+@property (class, nonatomic, readonly) BOOL sharesEventMiddlewares;
+
 
 #pragma mark - Extension
 
@@ -80,6 +96,25 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable Class)middlewareClassForLocation:(NSString *)location object:(CENObject *)object;
 
+/**
+ * @brief Get list of events for which middleware at specified \c location should be used.
+ *
+ * @discussion List used to build event filter of middleware instance which is created for
+ * \b {object CENObject}, so plugins with different configurations can register same middleware
+ * class for different events.
+ *
+ * @param location Location at which middleware expected to be used.
+ * @param object \b {Object CENObject} for which middleware at specified \c location will be
+ *     created.
+ *
+ * @return List of event names or \c nil in case if middleware's \b {CEPMiddleware.events} should
+ * be used.
+ *
+ * @since 0.10.0
+ */
+- (nullable NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)location
+                                                       object:(CENObject *)object;
+
 
 #pragma mark - Handlers
 
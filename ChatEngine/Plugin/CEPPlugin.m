@@ -56,6 +56,11 @@ NS_ASSUME_NONNULL_END
     return nil;
 }
 
++ (BOOL)sharesEventMiddlewares {
+    
+    return NO;
+}
+
 
 #pragma mark - Initialization and Configuration
 
@@ -102,6 +107,12 @@ NS_ASSUME_NONNULL_END
     return nil;
 }
 
+- (nullable NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                                       object:(CENObject *)__unused object {
+    
+    return nil;
+}
+
 
 #pragma mark - Handlers
 
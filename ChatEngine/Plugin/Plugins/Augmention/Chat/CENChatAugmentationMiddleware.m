@@ -20,6 +20,11 @@
     return CEPMiddlewareLocation.on;
 }
 
++ (BOOL)isSynchronous {
+    
+    return YES;
+}
+
 + (NSArray<NSString *> *)events {
     
     static NSArray<NSString *> *_chatAugmentationMiddlewareEvents;
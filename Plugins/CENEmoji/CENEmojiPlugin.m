@@ -53,6 +53,12 @@ CENEmojiConfigurationKeys CENEmojiConfiguration = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENEmojiConfiguration.events];
+}
+
 
 #pragma mark - Extension
 
@@ -105,9 +111,6 @@ CENEmojiConfigurationKeys CENEmojiConfiguration = {
     
     configuration[CENEmojiConfiguration.events] = events;
     self.configuration = configuration;
-    
-    [CENEmojiEmitMiddleware replaceEventsWith:self.configuration[CENEmojiConfiguration.events]];
-    [CENEmojiOnMiddleware replaceEventsWith:self.configuration[CENEmojiConfiguration.events]];
 }
 
 #pragma mark -
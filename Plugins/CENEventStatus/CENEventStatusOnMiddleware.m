@@ -48,12 +48,12 @@
     CENUser *sender = data[CENEventData.sender];
     
     if ([event isEqualToString:@"$.emitted"]) {
-        CENChat *chat = ((CENEvent *)self.object).chat;
+        CENChat *chat = data[CENEventData.chat] ?: ((CENEvent *)self.object).chat;
         NSString *emittedEvent = @"$.eventStatus.sent";
         eventStatusData = @{ CENEventData.data: eventStatusData };
         
         [chat.chatEngine triggerEventLocallyFrom:chat event:emittedEvent, eventStatusData, nil];
-    } else if ([sender isKindOfClass:[CENMe class]] && ![self.object isKindOfClass:[CENEvent class]]) {
+    } else if ([sender isKindOfClass:[CENMe class]] && [self.object isKindOfClass:[CENChat class]]) {
         CENChat *chat = (CENChat *)self.object;
         [chat emitEvent:@"$.eventStatus.delivered"
                withData:@{ CENEventStatusData.identifier: eventIdentifier }];
@@ -40,6 +40,11 @@ CENEventStatusDataKeys CENEventStatusData = {
     return @"com.chatengine.plugin.event-status";
 }
 
++ (BOOL)sharesEventMiddlewares {
+    
+    return YES;
+}
+
 
 #pragma mark - Middleware
 
@@ -58,6 +63,18 @@ CENEventStatusDataKeys CENEventStatusData = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)location
+                                              object:(CENObject *)__unused object {
+    
+    NSArray<NSString *> *events = self.configuration[CENEventStatusConfiguration.events];
+    
+    if ([location isEqualToString:CEPMiddlewareLocation.on]) {
+        events = [events arrayByAddingObject:@"$.emitted"];
+    }
+    
+    return events;
+}
+
 
 #pragma mark - Extension
 
@@ -94,9 +111,6 @@ CENEventStatusDataKeys CENEventStatusData = {
     
     configuration[CENEventStatusConfiguration.events] = events;
     self.configuration = configuration;
-    
-    [CENEventStatusEmitMiddleware replaceEventsWith:[events copy]];
-    [CENEventStatusOnMiddleware replaceEventsWith:[events arrayByAddingObject:@"$.emitted"]];
 }
 
 #pragma mark -
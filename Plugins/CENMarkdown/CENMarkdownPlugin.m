@@ -54,6 +54,12 @@ CENMarkdownConfigurationKeys CENMarkdownConfiguration = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENMarkdownConfiguration.events];
+}
+
 
 #pragma mark - Handlers
 
@@ -77,8 +83,6 @@ CENMarkdownConfigurationKeys CENMarkdownConfiguration = {
     
     configuration[CENMarkdownConfiguration.events] = events;
     self.configuration = configuration;
-    
-    [CENMarkdownMiddleware replaceEventsWith:self.configuration[CENMarkdownConfiguration.events]];
 }
 
 #pragma mark -
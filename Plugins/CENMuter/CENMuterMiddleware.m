@@ -22,6 +22,11 @@
     return CEPMiddlewareLocation.on;
 }
 
++ (BOOL)isSynchronous {
+    
+    return YES;
+}
+
 + (NSArray<NSString *> *)events {
     
     return @[@"*"];
@@ -48,6 +48,12 @@ CENMuterConfigurationKeys CENMuterConfiguration = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENMuterConfiguration.events];
+}
+
 
 #pragma mark - Extension
 
@@ -98,8 +104,6 @@ CENMuterConfigurationKeys CENMuterConfiguration = {
     
     configuration[CENMuterConfiguration.events] = events;
     self.configuration = configuration;
-    
-    [CENMuterMiddleware replaceEventsWith:self.configuration[CENMuterConfiguration.events]];
 }
 
 #pragma mark -
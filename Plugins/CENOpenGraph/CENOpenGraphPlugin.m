@@ -57,6 +57,12 @@ CENOpenGraphDataKeys CENOpenGraphData = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENOpenGraphConfiguration.events];
+}
+
 
 #pragma mark - Handlers
 
@@ -80,8 +86,6 @@ CENOpenGraphDataKeys CENOpenGraphData = {
     
     configuration[CENOpenGraphConfiguration.events] = events;
     self.configuration = configuration;
-    
-    [CENOpenGraphMiddleware replaceEventsWith:self.configuration[CENOpenGraphConfiguration.events]];
 }
 
 
@@ -113,6 +113,12 @@ NS_ASSUME_NONNULL_END
     return middleware;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENPushNotificationsConfiguration.events];
+}
+
 
 #pragma mark - Management notifications state
 
@@ -239,9 +245,6 @@ NS_ASSUME_NONNULL_END
     configuration[CENPushNotificationsConfiguration.events] = events;
     
     self.configuration = configuration;
-    
-    // Override events list with user-provided values.
-    [CENPushNotificationsMiddleware replaceEventsWith:events];
 }
 
 #pragma mark -
@@ -49,6 +49,12 @@ CENTypingIndicatorConfigurationKeys CENTypingIndicatorConfiguration = {
     return middlewareClass;
 }
 
+- (NSArray<NSString *> *)eventsForMiddlewareLocation:(NSString *)__unused location
+                                              object:(CENObject *)__unused object {
+    
+    return self.configuration[CENTypingIndicatorConfiguration.events];
+}
+
 
 #pragma mark - Extension
 
@@ -105,8 +111,6 @@ CENTypingIndicatorConfigurationKeys CENTypingIndicatorConfiguration = {
 
     configuration[CENTypingIndicatorConfiguration.events] = events;
     self.configuration = configuration;
-
-    [CENTypingIndicatorMiddleware replaceEventsWith:events];
 }
 
 #pragma mark -
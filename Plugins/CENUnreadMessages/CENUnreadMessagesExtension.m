@@ -36,6 +36,11 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, copy, nullable) CENEventHandlerBlock eventHandlerBlock;
 
+/**
+ * @brief List of tokens which has been received during \c eventHandlerBlock registration.
+ */
+@property (nonatomic, strong) NSMutableArray *eventHandlerTokens;
+
 
 #pragma mark - Handler
 
@@ -88,16 +93,22 @@ NS_ASSUME_NONNULL_END
         [strongSelf handleEvent:event];
     };
     
-    for (NSString *event in self.configuration[CENUnreadMessagesConfiguration.events]) {
-        [self.object handleEvent:event withHandlerBlock:self.eventHandlerBlock];
+    NSArray<NSString *> *events = self.configuration[CENUnreadMessagesConfiguration.events];
+    self.eventHandlerTokens = [NSMutableArray arrayWithCapacity:events.count];
+    
+    for (NSString *event in events) {
+        [self.eventHandlerTokens addObject:[self.object handleEvent:event
+                                                   withHandlerBlock:self.eventHandlerBlock]];
     }
 }
 
 - (void)onDestruct {
     
-    for (NSString *event in self.configuration[CENUnreadMessagesConfiguration.events]) {
-        [self.object removeHandler:self.eventHandlerBlock forEvent:event];
+    for (id token in self.eventHandlerTokens) {
+        [self.object removeHandlerWithToken:token];
     }
+    
+    [self.eventHandlerTokens removeAllObjects];
 }
 
 - (void)handleEvent:(NSDictionary *)payload {
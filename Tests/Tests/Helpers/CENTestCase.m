@@ -1135,6 +1135,7 @@ static char kCENTChatEngineTestStateInformationKey;
                         group:[OCMArg any]
                       private:isPrivate
                      metaData:[OCMArg any]
+           participantsPolicy:CENChatParticipantsUsers
                    chatEngine:[OCMArg any]];
 }
 
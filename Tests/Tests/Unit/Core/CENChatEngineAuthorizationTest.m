@@ -660,6 +660,37 @@
     }];
 }
 
+- (void)testHandshakeChatAccess_ShouldCallFailureBlock_WhenPubNubClientNotReady {
+    
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.client handshakeChatAccess:chat withCompletion:^{ } failure:handler];
+    }];
+}
+
+- (void)testHandshakeChatAccess_ShouldCallFailureBlock_WhenHandshakeDidFail {
+
+    NSError *error = [NSError errorWithDomain:@"TestDomain" code:-1 userInfo:nil];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    OCMStub([self.client pubnub]).andReturn(@"PubNub");
+    
+    id clientMock = [self mockForObject:self.client.functionClient];
+    OCMStub([clientMock callRouteSeries:[OCMArg any] withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        void(^block)(BOOL, NSArray *) = [self objectForInvocation:invocation argumentAtIndex:2];
+        block(NO, @[error]);
+    });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.client handshakeChatAccess:chat withCompletion:^{ } failure:handler];
+    }];
+}
+
 #pragma mark -
 
 
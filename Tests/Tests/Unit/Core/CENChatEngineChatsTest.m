@@ -118,6 +118,26 @@
     }];
 }
 
+- (void)testChatCreateChatWithName_ShouldPassParticipantsPolicyToChatsManager {
+    
+    CENChatParticipantsPolicy policy = CENChatParticipantsOccupancy;
+    NSString *name = @"test-chat";
+    
+    
+    id managerMock = [self mockForObject:self.client.chatsManager];
+    id recorded = OCMExpect([managerMock createGlobalChat:NO withName:name group:nil private:NO autoConnect:YES
+                                                 metaData:nil participantsPolicy:policy]);
+    [self waitForObject:managerMock recordedInvocationCall:recorded afterBlock:^{
+        self.client.Chat().name(name).participants(policy).create();
+    }];
+    
+    recorded = OCMExpect([managerMock createGlobalChat:NO withName:name group:nil private:NO autoConnect:YES
+                                              metaData:nil participantsPolicy:policy]);
+    [self waitForObject:managerMock recordedInvocationCall:recorded afterBlock:^{
+        [self.client createChatWithName:name private:NO autoConnect:YES metaData:nil participantsPolicy:policy];
+    }];
+}
+
 - (void)testChatCreateChatWithName_ShouldRegisterStateRestorePlugin {
     
     OCMStub([self.client global]).andReturn(@"PubNub");
@@ -819,7 +839,7 @@
     });
     
     id chatMock = [self mockForObject:chat];
-    id recorded = OCMExpect([chatMock handleRemoteUsers:[OCMArg any] stateChange:states]);
+    id recorded = OCMExpect([chatMock handleRemoteUsersRefresh:[OCMArg any] withStates:states]);
     [self waitForObject:chatMock recordedInvocationCall:recorded afterBlock:^{
         [self.client fetchParticipantsForChat:chat];
     }];
@@ -827,6 +847,47 @@
     OCMVerify(self.client);
 }
 
+- (void)testFetchParticipantsForChat_ShouldRequestOccupancy_WhenChatTracksOccupancy {
+    
+    CENChat *chat = [self.client createChatWithName:nil private:NO autoConnect:NO metaData:nil
+                                 participantsPolicy:CENChatParticipantsOccupancy];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    OCMExpect([[(id)self.client reject] fetchParticipantsForChannel:[OCMArg any] completion:[OCMArg any]]);
+    id recorded = OCMExpect([self.client fetchOccupancyForChannel:chat.channel completion:[OCMArg any]]);
+    [self waitForObject:self.client recordedInvocationCall:recorded afterBlock:^{
+        [self.client fetchParticipantsForChat:chat];
+    }];
+}
+
+- (void)testFetchParticipantsForChat_ShouldHandleOccupancyRefresh_WhenOccupancyReceived {
+    
+    CENChat *chat = [self.client createChatWithName:nil private:NO autoConnect:NO metaData:nil
+                                 participantsPolicy:CENChatParticipantsOccupancy];
+    PNPresenceChannelHereNowResult *result = [self hereNowResult];
+    NSUInteger expectedOccupancy = result.data.occupancy.unsignedIntegerValue;
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    OCMStub([self.client fetchOccupancyForChannel:[OCMArg any] completion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        PNHereNowCompletionBlock block = [self objectForInvocation:invocation argumentAtIndex:2];
+        block(result, nil);
+    });
+    
+    OCMExpect([[(id)self.client reject] createUserWithUUID:[OCMArg any] state:[OCMArg any]]);
+    
+    id chatMock = [self mockForObject:chat];
+    id recorded = OCMExpect([chatMock handleRemoteOccupancyRefresh:expectedOccupancy]);
+    [self waitForObject:chatMock recordedInvocationCall:recorded afterBlock:^{
+        [self.client fetchParticipantsForChat:chat];
+    }];
+    
+    OCMVerifyAll((id)self.client);
+}
+
 - (void)testFetchParticipantsForChat_ShouldThrow_WhenFetchDidFail {
     
     CENChat *chat = [self publicChatWithChatEngine:self.client];
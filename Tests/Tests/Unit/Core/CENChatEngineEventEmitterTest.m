@@ -9,6 +9,7 @@
 #import <CENChatEngine/CENChat+Private.h>
 #import <CENChatEngine/CENUser+Private.h>
 #import <CENChatEngine/CENErrorCodes.h>
+#import <CENChatEngine/CENEventAtom.h>
 #import <CENChatEngine/ChatEngine.h>
 #import <OCMock/OCMock.h>
 #import "CENTestCase.h"
@@ -226,8 +227,12 @@
 
     XCTAssertTrue([self isObjectMocked:self.client]);
 
+    [self.client handleEvent:@"$.error.test-error" withHandlerBlock:^(CENEmittedEvent *event) { }];
+    
     id userMock = [self mockForObject:user];
-    OCMExpect([self.client emitEventLocally:@"$.error.test-error" withParameters:clientExpectedParameters]);
+    OCMExpect([self.client emitEventAtom:[OCMArg checkWithBlock:^BOOL(CENEventAtom *atom) {
+        return [atom.name isEqualToString:@"$.error.test-error"];
+    }] withParameters:clientExpectedParameters]);
     OCMExpect([userMock emitEventLocally:@"$.error.test-error" withParameters:@[error]]).andForwardToRealObject();
     
     [self.client throwError:error forScope:@"test-error" from:user propagateFlow:CEExceptionPropagationFlow.middleware];
@@ -144,6 +144,18 @@
     }];
 }
 
+- (void)testSetupProtoPluginsForObjects_ShouldConfigureProtoForObjectsUsingPluginsManager {
+    
+    NSArray<CENChat *> *expectedChats = @[[self publicChatWithChatEngine:self.client]];
+    
+    
+    id managerMock = [self mockForObject:self.client.pluginsManager];
+    id recorded = OCMExpect([managerMock setupProtoPluginsForObjects:expectedChats withCompletion:[OCMArg any]]);
+    [self waitForObject:managerMock recordedInvocationCall:recorded afterBlock:^{
+        [self.client setupProtoPluginsForObjects:expectedChats withCompletion:^{}];
+    }];
+}
+
 
 #pragma mark - Tests :: proto / registerProtoPlugin
 
@@ -679,6 +679,21 @@
     }];
 }
 
+- (void)testClientDidReceiveMessage_ShouldFindChatByChannel {
+
+    CENChat *expectedChat = self.client.me.direct;
+    PNMessageResult *result = [self messageResultForChat:expectedChat withData:@{ @"received": @"data" }];
+
+
+    id managerMock = [self mockForObject:self.client.chatsManager];
+    OCMExpect([[managerMock reject] chatWithName:[OCMArg any] private:NO]);
+    OCMExpect([[managerMock reject] chatWithName:[OCMArg any] private:YES]);
+    id recorded = OCMExpect([managerMock chatForChannel:expectedChat.channel]);
+    [self waitForObject:managerMock recordedInvocationCall:recorded afterBlock:^{
+        [(id<PNObjectEventListener>)self.client client:self.client.pubnub didReceiveMessage:result];
+    }];
+}
+
 
 #pragma mark - Tests :: clientDidReceivePresenceEvent
 
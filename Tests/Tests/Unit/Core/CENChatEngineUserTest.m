@@ -174,6 +174,26 @@
     }];
 }
 
+- (void)testFetchUserState_ShouldCallHandlerWithNil_WhenStateFetchDidFail {
+    
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    
+    
+    id clientMock = [self mockForObject:self.client.functionClient];
+    OCMStub([clientMock callRouteSeries:[OCMArg any] withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        void(^handlerBlock)(BOOL, NSArray *) = [self objectForInvocation:invocation argumentAtIndex:2];
+        handlerBlock(NO, @[[NSError errorWithDomain:@"TestDomain" code:0 userInfo:nil]]);
+    });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.client fetchUserState:user forChat:chat withCompletion:^(NSDictionary *state) {
+            XCTAssertNil(state);
+            handler();
+        }];
+    }];
+}
+
 
 #pragma mark - Tests :: destroyUsers
 
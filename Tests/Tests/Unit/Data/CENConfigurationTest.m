@@ -51,6 +51,14 @@
     XCTAssertEqual(self.configuration.presenceHeartbeatInterval, kCENDefaultPresenceHeartbeatInterval);
     XCTAssertEqualObjects(self.configuration.globalChannel, kCENDefaultGlobalChannel);
     XCTAssertEqual(self.configuration.shouldSynchronizeSession, kCENDefaultShouldSynchronizeSession);
+    XCTAssertEqual(self.configuration.eventDeliveryMode, kCENDefaultEventDeliveryMode);
+    XCTAssertEqual(self.configuration.shouldProfileMiddlewares, kCENDefaultProfileMiddlewares);
+    XCTAssertEqual(self.configuration.middlewareMetricsInterval, kCENDefaultMiddlewareMetricsInterval);
+    XCTAssertEqual(self.configuration.middlewareTimeout, kCENDefaultMiddlewareTimeout);
+    XCTAssertEqual(self.configuration.maximumUsersCount, kCENDefaultMaximumUsersCount);
+    XCTAssertEqual(self.configuration.maximumConcurrentChatWakes,
+                   kCENDefaultMaximumConcurrentChatWakes);
+    XCTAssertEqual(self.configuration.shouldBatchPresenceEvents, kCENDefaultBatchPresenceEvents);
     XCTAssertNotNil(self.configuration.functionEndpoint);
     XCTAssertTrue([self.configuration.functionEndpoint hasPrefix:kCENPNFunctionsBaseURI]);
 }
@@ -97,6 +105,13 @@
     self.configuration.functionEndpoint = @"https://pubnub.com";
     self.configuration.synchronizeSession = YES;
     self.configuration.throwExceptions = YES;
+    self.configuration.eventDeliveryMode = CENEventDeliveryOrdered;
+    self.configuration.profileMiddlewares = YES;
+    self.configuration.middlewareMetricsInterval = 30.f;
+    self.configuration.middlewareTimeout = 2.f;
+    self.configuration.maximumUsersCount = 1000;
+    self.configuration.maximumConcurrentChatWakes = 5;
+    self.configuration.batchPresenceEvents = YES;
     
     CENConfiguration *configurationCopy = [self.configuration copy];
     
@@ -107,6 +122,14 @@
     XCTAssertEqual(configurationCopy.presenceHeartbeatValue, self.configuration.presenceHeartbeatValue);
     XCTAssertEqual(configurationCopy.shouldSynchronizeSession, self.configuration.shouldSynchronizeSession);
     XCTAssertEqual(configurationCopy.shouldThrowExceptions, self.configuration.shouldThrowExceptions);
+    XCTAssertEqual(configurationCopy.eventDeliveryMode, self.configuration.eventDeliveryMode);
+    XCTAssertEqual(configurationCopy.shouldProfileMiddlewares, self.configuration.shouldProfileMiddlewares);
+    XCTAssertEqual(configurationCopy.middlewareMetricsInterval, self.configuration.middlewareMetricsInterval);
+    XCTAssertEqual(configurationCopy.middlewareTimeout, self.configuration.middlewareTimeout);
+    XCTAssertEqual(configurationCopy.maximumUsersCount, self.configuration.maximumUsersCount);
+    XCTAssertEqual(configurationCopy.maximumConcurrentChatWakes,
+                   self.configuration.maximumConcurrentChatWakes);
+    XCTAssertEqual(configurationCopy.shouldBatchPresenceEvents, self.configuration.shouldBatchPresenceEvents);
 }
 
 
@@ -273,6 +296,53 @@
 }
 
 
+#pragma mark - Tests :: Property :: eventDeliveryMode
+
+- (void)testSetEventDeliveryMode_ShouldChange_WhenKnownModePassed {
+    
+    self.configuration.eventDeliveryMode = CENEventDeliverySynchronous;
+    
+    XCTAssertEqual(self.configuration.eventDeliveryMode, CENEventDeliverySynchronous);
+}
+
+- (void)testSetEventDeliveryMode_ShouldSetDefault_WhenUnknownModePassed {
+    
+    self.configuration.eventDeliveryMode = CENEventDeliveryOrdered;
+    
+    self.configuration.eventDeliveryMode = (CENEventDeliveryMode)100;
+    
+    XCTAssertEqual(self.configuration.eventDeliveryMode, kCENDefaultEventDeliveryMode);
+}
+
+
+
+#pragma mark - Tests :: Property :: middlewareMetricsInterval
+
+- (void)testSetMiddlewareMetricsInterval_ShouldChange_WhenPositiveIntervalPassed {
+    
+    self.configuration.middlewareMetricsInterval = 10.f;
+    
+    XCTAssertEqual(self.configuration.middlewareMetricsInterval, 10.f);
+}
+
+- (void)testSetMiddlewareMetricsInterval_ShouldSetZero_WhenNegativeIntervalPassed {
+    
+    self.configuration.middlewareMetricsInterval = -10.f;
+    
+    XCTAssertEqual(self.configuration.middlewareMetricsInterval, 0.f);
+}
+
+
+#pragma mark - Tests :: Property :: middlewareTimeout
+
+- (void)testSetMiddlewareTimeout_ShouldSetZero_WhenNegativeTimeoutPassed {
+    
+    self.configuration.middlewareTimeout = -1.f;
+    
+    XCTAssertEqual(self.configuration.middlewareTimeout, 0.f);
+}
+
+
 #pragma mark - Tests :: pubNubConfiguration
 
 - (void)testPubNubConfiguration_ShouldReturnPubNubClientConfiguration {
@@ -3,7 +3,12 @@
  * @copyright © 2010-2018 PubNub, Inc.
  */
 #import <CENChatEngine/CENEventEmitter+BuilderInterface.h>
+#import <CENChatEngine/CENEventEmitter+Interface.h>
 #import <CENChatEngine/CENEventEmitter+Private.h>
+#import <CENChatEngine/CENEventHandlersTree.h>
+#import <CENChatEngine/CENChat+Private.h>
+#import <CENChatEngine/CENEventHandler.h>
+#import <CENChatEngine/CENEventAtom.h>
 #import <CENChatEngine/ChatEngine.h>
 #import "CENTestEventEmitter.h"
 #import "CENTestCase.h"
@@ -21,6 +26,50 @@
 @end
 
 
+#pragma mark - Legacy events matching
+
+/**
+ * @brief Linear registered event names matching which has been used by emitter before handlers has
+ * been moved to tree.
+ *
+ * @discussion Used as baseline for handlers lookup performance tests.
+ */
+static NSArray<NSString *> * CENLegacyEventNamesForEvent(NSArray<NSString *> *registeredEvents,
+                                                          NSString *event) {
+    
+    NSMutableArray<NSString *> *eventNames = [NSMutableArray array];
+    NSMutableArray<NSString *> *components = [[event componentsSeparatedByString:@"."] mutableCopy];
+    NSUInteger componentsCount = components.count;
+    NSString *nextEventName = event;
+    
+    while (nextEventName != nil) {
+        NSString *xxEventName = [nextEventName stringByAppendingString:@".**"];
+        NSString *xEventName = [nextEventName stringByAppendingString:@".*"];
+        
+        if ([registeredEvents containsObject:nextEventName]) {
+            [eventNames addObject:nextEventName];
+        }
+        
+        if ((componentsCount - components.count) == 1 &&
+            [registeredEvents containsObject:xEventName]) {
+            
+            [eventNames addObject:xEventName];
+        }
+        
+        if ((componentsCount - components.count) >= 1 &&
+            [registeredEvents containsObject:xxEventName]) {
+            
+            [eventNames addObject:xxEventName];
+        }
+        
+        [components removeLastObject];
+        nextEventName = components.count ? [components componentsJoinedByString:@"."] : nil;
+    }
+    
+    return eventNames;
+}
+
+
 #pragma mark - Tests
 
 @implementation CENEventEmitterTest
@@ -467,6 +516,75 @@
 }
 
 
+#pragma mark - Tests :: removeHandlerWithToken
+
+- (void)testThat_RegisteredHandler_WhenRemovedWithToken_ThenHandlerRemovedFromObserversList {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    NSArray<NSString *> *expected = @[];
+    __block BOOL handlerCalled = NO;
+    
+    
+    id token = [self.emitter handleEvent:@"test-event" withHandlerBlock:^(CENEmittedEvent *event) {
+        handlerCalled = YES;
+        
+        dispatch_semaphore_signal(semaphore);
+    }];
+    
+    XCTAssertNotNil(token);
+    [self.emitter removeHandlerWithToken:token];
+    [self.emitter emitEventLocally:@"test-event", nil];
+    
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.falseTestCompletionDelay * NSEC_PER_SEC)));
+    XCTAssertEqualObjects(self.emitter.eventNames, expected);
+    XCTAssertFalse(handlerCalled);
+}
+
+- (void)testThat_SameHandlerRegisteredTwice_WhenOneRemovedWithToken_ThenAnotherHandlerShouldStayInList {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    NSArray<NSString *> *expected = @[@"test-event"];
+    __block NSUInteger handlerCallCount = 0;
+    
+    CENEventHandlerBlock handler = ^(CENEmittedEvent *event) {
+        handlerCallCount++;
+        
+        dispatch_semaphore_signal(semaphore);
+    };
+    
+    
+    id token = [self.emitter handleEvent:@"test-event" withHandlerBlock:handler];
+    [self.emitter handleEvent:@"test-event" withHandlerBlock:handler];
+    
+    [self.emitter removeHandlerWithToken:token];
+    [self.emitter emitEventLocally:@"test-event", nil];
+    
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.testCompletionDelay * NSEC_PER_SEC)));
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.falseTestCompletionDelay * NSEC_PER_SEC)));
+    XCTAssertEqualObjects(self.emitter.eventNames, expected);
+    XCTAssertEqual(handlerCallCount, 1);
+}
+
+- (void)testThat_OnceHandlerRegistered_WhenRemovedWithTokenBeforeEmit_ThenHandlerNotCalled {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    __block BOOL handlerCalled = NO;
+    
+    
+    id token = [self.emitter handleEventOnce:@"test.*" withHandlerBlock:^(CENEmittedEvent *event) {
+        handlerCalled = YES;
+        
+        dispatch_semaphore_signal(semaphore);
+    }];
+    
+    [self.emitter removeHandlerWithToken:token];
+    [self.emitter emitEventLocally:@"test.event", nil];
+    
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.falseTestCompletionDelay * NSEC_PER_SEC)));
+    XCTAssertFalse(handlerCalled);
+}
+
+
 #pragma mark - Tests :: Property :: offAny
 
 - (void)testThat_RegisteredTwoHandlersOnWildcardEvents_WhenOneHandlerRemoved_ThenAnotherHandlerShouldStayInList {
@@ -654,7 +772,247 @@
     XCTAssertFalse(handler2Called);
 }
 
+- (void)testThat_RegisteredHandlers_WhenEventRemoveAllListeners_ThenHandlerTokensInvalidated {
+    
+    CENEventHandler *token1 = [self.emitter handleEvent:@"test.event" withHandlerBlock:^(CENEmittedEvent *event) {}];
+    CENEventHandler *token2 = [self.emitter handleEvent:@"test.event.2" withHandlerBlock:^(CENEmittedEvent *event) {}];
+    
+    
+    [self.emitter removeAllHandlersForEvent:@"test.**"];
+    
+    XCTAssertTrue(token1.isInvalidated);
+    XCTAssertTrue(token2.isInvalidated);
+}
+
+
+#pragma mark - Tests :: CENEventAtom
+
+- (void)testThat_EventNameNormalized_WhenAtomRequestedWithDifferentCase_ThenEqualAtomReturned {
+    
+    CENEventAtom *atom = [CENEventAtom atomForEvent:@"$.Test.Event"];
+    
+    XCTAssertEqualObjects(atom.event, @"$.Test.Event");
+    XCTAssertEqualObjects(atom.name, @"$.test.event");
+    XCTAssertEqualObjects(atom.components, (@[@"$", @"test", @"event"]));
+    XCTAssertEqualObjects([CENEventAtom atomForEvent:@"$.test.event"], atom);
+    XCTAssertEqualObjects([CENEventAtom atomForEvent:@"$.Test.Event"], atom);
+}
 
+- (void)testThat_AtomRequested_WhenNonNSStringPassed_ThenNilReturned {
+    
+    XCTAssertNil([CENEventAtom atomForEvent:(id)@2010]);
+    XCTAssertNil([CENEventAtom atomForEvent:nil]);
+}
+
+
+#pragma mark - Tests :: hasHandlersForEvent
+
+- (void)testThat_HandlerRegisteredOnEventWithWildcard_WhenCheckedEmittedEvent_ThenHasHandlers {
+    
+    [self.emitter handleEvent:@"$.test.*" withHandlerBlock:^(CENEmittedEvent *event) {}];
+    
+    XCTAssertTrue([self.emitter hasHandlersForEvent:@"$.test.event"]);
+    XCTAssertFalse([self.emitter hasHandlersForEvent:@"$.test.event.nested"]);
+    XCTAssertFalse([self.emitter hasHandlersForEvent:@"$.other"]);
+}
+
+- (void)testThat_HandlerRegisteredForAnyEvent_WhenCheckedEmittedEvent_ThenHasHandlers {
+    
+    XCTAssertFalse([self.emitter hasHandlersForEvent:@"test-event"]);
+    
+    [self.emitter handleEvent:@"*" withHandlerBlock:^(CENEmittedEvent *event) {}];
+    
+    XCTAssertTrue([self.emitter hasHandlersForEvent:@"test-event"]);
+}
+
+
+#pragma mark - Tests :: deliveryMode
+
+- (void)testThat_OrderedDeliveryMode_WhenEmittedMultipleEvents_ThenHandlerReceiveThemInEmitOrder {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    NSMutableArray<NSNumber *> *received = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *expected = [NSMutableArray new];
+    NSUInteger eventsCount = 1000;
+    self.emitter.deliveryMode = CENEventDeliveryOrdered;
+    
+    
+    [self.emitter handleEvent:@"test-event" withHandlerBlock:^(CENEmittedEvent *event) {
+        [received addObject:event.data];
+        
+        if (received.count == eventsCount) {
+            dispatch_semaphore_signal(semaphore);
+        }
+    }];
+    
+    for (NSUInteger eventIdx = 0; eventIdx < eventsCount; eventIdx++) {
+        [expected addObject:@(eventIdx)];
+        [self.emitter emitEventLocally:@"test-event", @(eventIdx), nil];
+    }
+    
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.testCompletionDelay * NSEC_PER_SEC)));
+    XCTAssertEqualObjects(received, expected);
+}
+
+- (void)testThat_SynchronousDeliveryMode_WhenEmittedEvent_ThenHandlerCalledOnEmittingThreadBeforeEmitReturn {
+    
+    NSThread *emittingThread = [NSThread currentThread];
+    __block NSThread *handlerThread = nil;
+    __block BOOL handlerCalled = NO;
+    self.emitter.deliveryMode = CENEventDeliverySynchronous;
+    
+    
+    [self.emitter handleEvent:@"test-event" withHandlerBlock:^(CENEmittedEvent *event) {
+        handlerThread = [NSThread currentThread];
+        handlerCalled = YES;
+    }];
+    
+    [self.emitter emitEventLocally:@"test-event", nil];
+    
+    XCTAssertTrue(handlerCalled);
+    XCTAssertEqualObjects(handlerThread, emittingThread);
+}
+
+- (void)testThat_SynchronousDeliveryMode_WhenChatConnectedHandlerReadUsers_ThenHandlerNotDeadlocked {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    CENConfiguration *configuration = [self defaultConfiguration];
+    configuration.eventDeliveryMode = CENEventDeliverySynchronous;
+    CENChatEngine *client = [self createChatEngineWithConfiguration:configuration];
+    __block NSDictionary<NSString *, CENUser *> *users = nil;
+    
+    
+    CENChat *chat = [self publicChatWithChatEngine:client];
+    [chat handleEvent:@"$.connected" withHandlerBlock:^(CENEmittedEvent *event) {
+        users = ((CENChat *)event.emitter).users;
+        dispatch_semaphore_signal(semaphore);
+    }];
+    
+    [chat handleConnection];
+    
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.testCompletionDelay * NSEC_PER_SEC)));
+    XCTAssertNotNil(users);
+}
+
+- (void)testThat_ChatCreated_WhenConfigurationUseOrderedDeliveryMode_ThenChatUseSameMode {
+    
+    CENConfiguration *configuration = [self defaultConfiguration];
+    configuration.eventDeliveryMode = CENEventDeliveryOrdered;
+    CENChatEngine *client = [self createChatEngineWithConfiguration:configuration];
+    
+    
+    CENChat *chat = [self publicChatWithChatEngine:client];
+    
+    XCTAssertEqual(client.deliveryMode, CENEventDeliveryOrdered);
+    XCTAssertEqual(chat.deliveryMode, CENEventDeliveryOrdered);
+}
+
+
+#pragma mark - Tests :: Performance
+
+- (NSArray<NSString *> *)registeredEventNamesForPerformanceTest {
+    
+    NSMutableArray<NSString *> *eventNames = [NSMutableArray arrayWithCapacity:10000];
+    
+    for (NSUInteger eventIdx = 0; eventIdx < 10000; eventIdx++) {
+        NSString *group = [@(eventIdx / 100) stringValue];
+        NSString *name = [@(eventIdx % 100) stringValue];
+        
+        if (eventIdx % 100 == 98) {
+            name = @"*";
+        } else if (eventIdx % 100 == 99) {
+            name = @"**";
+        }
+        
+        [eventNames addObject:[@[@"$", group, name] componentsJoinedByString:@"."]];
+    }
+    
+    return eventNames;
+}
+
+- (void)testThat_HandlersTree_WhenMatchingEvent_ThenFoundSameEventsAsLegacyMatching {
+    
+    NSArray<NSString *> *registeredEvents = [self registeredEventNamesForPerformanceTest];
+    CENEventHandlersTree *tree = [CENEventHandlersTree new];
+    NSArray<NSString *> *events = @[@"$.42.17", @"$.42.17.sent", @"$.42", @"$.unknown.1"];
+    
+    
+    for (NSString *event in registeredEvents) {
+        [tree addHandler:event forEvent:event];
+    }
+    
+    for (NSString *event in events) {
+        NSSet *expected = [NSSet setWithArray:CENLegacyEventNamesForEvent(registeredEvents, event)];
+        
+        XCTAssertEqualObjects([NSSet setWithArray:[tree eventNamesForEvent:event]], expected);
+    }
+}
+
+- (void)testPerformance_LegacyEventsMatching_WhenTenThousandEventsRegistered {
+    
+    NSArray<NSString *> *registeredEvents = [self registeredEventNamesForPerformanceTest];
+    
+    
+    [self measureBlock:^{
+        for (NSUInteger eventIdx = 0; eventIdx < 100; eventIdx++) {
+            NSString *event = [NSString stringWithFormat:@"$.%@.17", @(eventIdx)];
+            
+            CENLegacyEventNamesForEvent(registeredEvents, event);
+        }
+    }];
+}
+
+- (void)testPerformance_HandlersTreeEventsMatching_WhenTenThousandEventsRegistered {
+    
+    NSArray<NSString *> *registeredEvents = [self registeredEventNamesForPerformanceTest];
+    CENEventHandlersTree *tree = [CENEventHandlersTree new];
+    
+    
+    for (NSString *event in registeredEvents) {
+        [tree addHandler:event forEvent:event];
+    }
+    
+    [self measureBlock:^{
+        for (NSUInteger eventIdx = 0; eventIdx < 100; eventIdx++) {
+            NSString *event = [NSString stringWithFormat:@"$.%@.17", @(eventIdx)];
+            
+            [tree handlersForEvent:event];
+        }
+    }];
+}
+
+- (void)testPerformance_ChatEventsEmitting_WhenHandlersAddedAndRemovedConcurrently {
+    
+    dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSUInteger emittersCount = 8;
+    
+    
+    [chat handleEvent:@"$.test.*" withHandlerBlock:^(CENEmittedEvent *event) {}];
+    
+    [self measureBlock:^{
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (NSUInteger emitterIdx = 0; emitterIdx < emittersCount; emitterIdx++) {
+            dispatch_group_async(group, queue, ^{
+                for (NSUInteger eventIdx = 0; eventIdx < 1000; eventIdx++) {
+                    [chat emitEventLocally:@"$.test.event" withParameters:@[]];
+                }
+            });
+        }
+        
+        dispatch_group_async(group, queue, ^{
+            for (NSUInteger handlerIdx = 0; handlerIdx < 1000; handlerIdx++) {
+                id token = [chat handleEvent:@"$.test.event"
+                            withHandlerBlock:^(CENEmittedEvent *event) {}];
+                
+                [chat removeHandlerWithToken:token];
+            }
+        });
+        
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    }];
+}
 
 #pragma mark -
 
@@ -3,6 +3,7 @@
  * @copyright © 2010-2018 PubNub, Inc.
  */
 #import <CENChatEngine/CENChatEngine+AuthorizationPrivate.h>
+#import <CENChatEngine/CENChatEngine+PluginsPrivate.h>
 #import <CENChatEngine/CENChatEngine+EventEmitter.h>
 #import <CENChatEngine/CENChatEngine+Private.h>
 #import <CENChatEngine/CENChat+Interface.h>
@@ -12,6 +13,21 @@
 #import "CENTestCase.h"
 
 
+#pragma mark Extension for test
+
+@interface CENChatsManager (TestExtension)
+
+
+#pragma mark - Misc
+
+- (void)updateChannelsIndex;
+
+#pragma mark -
+
+
+@end
+
+
 @interface CENChatsManagerTest : CENTestCase
 
 
@@ -51,6 +67,18 @@
     return YES;
 }
 
+- (CENConfiguration *)configurationForTestCaseWithName:(NSString *)name {
+    
+    CENConfiguration *configuration = [super configurationForTestCaseWithName:name];
+    configuration.batchPresenceEvents = [name rangeOfString:@"WhenPresenceBatchingEnabled"].location != NSNotFound;
+    
+    if ([name rangeOfString:@"WhenChatWakesLimited"].location != NSNotFound) {
+        configuration.maximumConcurrentChatWakes = 1;
+    }
+    
+    return configuration;
+}
+
 - (void)setUp {
     
     [super setUp];
@@ -175,6 +203,85 @@
     XCTAssertNotEqualObjects(self.manager.global.group, expectedGroup);
 }
 
+- (void)testCreateChatWithName_ShouldCreateChatWithParticipantsPolicy_WhenPolicyPassed {
+    
+    CENChat *chat = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil
+                                participantsPolicy:CENChatParticipantsOccupancy];
+    
+    
+    XCTAssertEqual(chat.participantsPolicy, CENChatParticipantsOccupancy);
+}
+
+- (void)testCreateChatWithName_ShouldTrackUsers_WhenPolicyNotPassed {
+    
+    CENChat *chat = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    
+    
+    XCTAssertEqual(chat.participantsPolicy, CENChatParticipantsUsers);
+}
+
+
+#pragma mark - Tests :: createChatsWithNames
+
+- (void)testCreateChatsWithNames_ShouldCreateChatsInSameOrderAsNames {
+    
+    NSArray<NSString *> *expectedNames = @[@"TestChat4", @"TestChat5", @"TestChat6"];
+    NSString *expectedGroup = CENChatGroup.custom;
+    
+    
+    NSArray<CENChat *> *chats = [self.manager createChatsWithNames:expectedNames group:nil];
+    
+    XCTAssertEqualObjects([chats valueForKey:@"name"], expectedNames);
+    XCTAssertEqualObjects(chats.firstObject.group, expectedGroup);
+    XCTAssertEqual(self.manager.chats.count, expectedNames.count);
+}
+
+- (void)testCreateChatsWithNames_ShouldSetupProtoPluginsOnlyForNewChats {
+    
+    NSArray<NSString *> *names = @[@"TestChat7", @"TestChat8"];
+    
+    
+    CENChat *existingChat = [self.manager createGlobalChat:NO withName:names.firstObject group:nil private:NO autoConnect:NO
+                                                  metaData:nil];
+    
+    id recorded = OCMExpect([(id)self.client setupProtoPluginsForObjects:[OCMArg checkWithBlock:^BOOL(NSArray *chats) {
+        return chats.count == 1 && [((CENChat *)chats.firstObject).name isEqualToString:names.lastObject];
+    }] withCompletion:[OCMArg any]]);
+    [self waitForObject:self.client recordedInvocationCall:recorded afterBlock:^{
+        NSArray<CENChat *> *chats = [self.manager createChatsWithNames:names group:nil];
+        
+        XCTAssertEqual(chats.firstObject, existingChat);
+    }];
+}
+
+- (void)testCreateChatsWithNames_ShouldIndexAllCreatedChats {
+    
+    NSArray<NSString *> *names = @[@"TestChat9", @"TestChat10", @"TestChat11"];
+    
+    
+    NSArray<CENChat *> *chats = [self.manager createChatsWithNames:names group:nil];
+    
+    for (CENChat *chat in chats) {
+        XCTAssertEqual([self.manager chatForChannel:chat.channel], chat);
+    }
+}
+
+- (void)testCreateChatsWithNames_ShouldUpdateChannelsIndexOnce_WhenBatchCreated {
+    
+    NSArray<NSString *> *names = @[@"TestChat12", @"TestChat13", @"TestChat14"];
+    __block NSUInteger indexUpdatesCount = 0;
+    
+    
+    id managerMock = [self mockForObject:self.manager];
+    OCMStub([managerMock updateChannelsIndex]).andDo(^(NSInvocation *invocation) {
+        indexUpdatesCount++;
+    });
+    
+    [self.manager createChatsWithNames:names group:nil];
+    
+    XCTAssertEqual(indexUpdatesCount, 1);
+}
+
 
 #pragma mark - Tests :: chatWithName
 
@@ -216,6 +323,52 @@
 }
 
 
+#pragma mark - Tests :: chatForChannel
+
+- (void)testChatForChannel_ShouldReturnCreatedChat {
+    
+    CENChat *chat = [self.manager createGlobalChat:NO withName:@"TestChat6" group:nil private:YES autoConnect:NO metaData:nil];
+    
+    
+    XCTAssertEqual([self.manager chatForChannel:chat.channel], chat);
+}
+
+- (void)testChatForChannel_ShouldReturnGlobal {
+    
+    CENChat *chat = [self.manager createGlobalChat:YES withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    
+    
+    XCTAssertEqual([self.manager chatForChannel:chat.channel], chat);
+}
+
+- (void)testChatForChannel_ShouldReturnNil_WhenChatNameUsedInsteadOfChannel {
+    
+    CENChat *chat = [self.manager createGlobalChat:NO withName:@"TestChat6" group:nil private:NO autoConnect:NO metaData:nil];
+    
+    
+    XCTAssertNil([self.manager chatForChannel:chat.name]);
+}
+
+- (void)testChatForChannel_ShouldReturnNil_WhenChatRemoved {
+    
+    CENChat *chat = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    
+    
+    [self.manager removeChat:chat];
+    
+    XCTAssertEqual(self.manager.chats.count, 0);
+    XCTAssertNil([self.manager chatForChannel:chat.channel]);
+}
+
+- (void)testChatForChannel_ShouldReturnNil_WhenNonNSStringPassed {
+    
+    NSString *channel = (id)@2010;
+    
+    
+    XCTAssertNil([self.manager chatForChannel:channel]);
+}
+
+
 #pragma mark - Tests :: connectChats
 
 - (void)testConnectChats_ShouldWakeGlobalChat {
@@ -226,7 +379,7 @@
     OCMStub([chatMock asleep]).andReturn(YES);
     
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
-        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
             CENChat *awakenChat = [self objectForInvocation:invocation argumentAtIndex:1];
             
             if ([awakenChat.channel isEqualToString:self.client.global.channel]) {
@@ -247,7 +400,7 @@
     OCMStub([chatMock asleep]).andReturn(YES);
     
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
-        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
             CENChat *awakenChat = [self objectForInvocation:invocation argumentAtIndex:1];
             
             if ([awakenChat.channel isEqualToString:chat.channel]) {
@@ -259,6 +412,109 @@
     }];
 }
 
+- (void)testConnectChats_ShouldNotWakeNextChat_WhenChatWakesLimitedAndHandshakeNotCompleted {
+    
+    CENChat *chat1 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    CENChat *chat2 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    __block NSUInteger handshakesCount = 0;
+    
+    
+    OCMStub([(CENChat *)[self mockForObject:chat1] asleep]).andReturn(YES);
+    OCMStub([(CENChat *)[self mockForObject:chat2] asleep]).andReturn(YES);
+    
+    [self waitToNotCompleteIn:self.falseTestCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+            handshakesCount++;
+            
+            if (handshakesCount > 1) {
+                handler();
+            }
+        });
+    } afterBlock:^{
+        [self.manager connectChats];
+    }];
+}
+
+- (void)testConnectChats_ShouldWakeNextChat_WhenChatWakesLimitedAndHandshakeCompleted {
+    
+    CENChat *chat1 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    CENChat *chat2 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    __block CENChat *firstAwakenChat = nil;
+    
+    
+    OCMStub([(CENChat *)[self mockForObject:chat1] asleep]).andReturn(YES);
+    OCMStub([(CENChat *)[self mockForObject:chat2] asleep]).andReturn(YES);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+            CENChat *awakenChat = [self objectForInvocation:invocation argumentAtIndex:1];
+            dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
+            
+            if (!firstAwakenChat) {
+                firstAwakenChat = awakenChat;
+                block();
+            } else if (![awakenChat.channel isEqualToString:firstAwakenChat.channel]) {
+                handler();
+            }
+        });
+    } afterBlock:^{
+        [self.manager connectChats];
+    }];
+}
+
+- (void)testConnectChats_ShouldWakeNextChat_WhenChatWakesLimitedAndHandshakeFailed {
+    
+    CENChat *chat1 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    CENChat *chat2 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    __block CENChat *firstAwakenChat = nil;
+    
+    
+    OCMStub([(CENChat *)[self mockForObject:chat1] asleep]).andReturn(YES);
+    OCMStub([(CENChat *)[self mockForObject:chat2] asleep]).andReturn(YES);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+            CENChat *awakenChat = [self objectForInvocation:invocation argumentAtIndex:1];
+            dispatch_block_t failure = [self objectForInvocation:invocation argumentAtIndex:3];
+            
+            if (!firstAwakenChat) {
+                firstAwakenChat = awakenChat;
+                failure();
+            } else if (![awakenChat.channel isEqualToString:firstAwakenChat.channel]) {
+                handler();
+            }
+        });
+    } afterBlock:^{
+        [self.manager connectChats];
+    }];
+}
+
+- (void)testConnectChats_ShouldWakeChatWithHigherPriorityFirst_WhenChatWakesLimited {
+    
+    CENChat *chat1 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    CENChat *chat2 = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    __block BOOL handshakeStarted = NO;
+    chat2.wakePriority = 10;
+    
+    
+    OCMStub([(CENChat *)[self mockForObject:chat1] asleep]).andReturn(YES);
+    OCMStub([(CENChat *)[self mockForObject:chat2] asleep]).andReturn(YES);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        OCMStub([self.client handshakeChatAccess:[OCMArg any] withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+            CENChat *awakenChat = [self objectForInvocation:invocation argumentAtIndex:1];
+            
+            if (!handshakeStarted) {
+                handshakeStarted = YES;
+                XCTAssertEqualObjects(awakenChat.channel, chat2.channel);
+                handler();
+            }
+        });
+    } afterBlock:^{
+        [self.manager connectChats];
+    }];
+}
+
 
 #pragma mark - Tests :: resetConnection
 
@@ -302,6 +558,22 @@
 }
 
 
+#pragma mark - Tests :: chatsWithNames
+
+- (void)testChatsWithNames_ShouldReturnOnlyCreatedChats {
+    
+    NSArray<NSString *> *names = @[@"TestChat15", @"TestChat16"];
+    
+    
+    NSArray<CENChat *> *chats = [self.manager createChatsWithNames:names group:nil];
+    NSArray<CENChat *> *foundChats = [self.manager chatsWithNames:[names arrayByAddingObject:@"TestChat17"]
+                                                          private:NO];
+    
+    XCTAssertEqual(foundChats.count, chats.count);
+    XCTAssertEqualObjects([NSSet setWithArray:foundChats], [NSSet setWithArray:chats]);
+}
+
+
 #pragma mark - Tests :: removeChat
 
 - (void)testRemoveChat_ShouldRemovePreviouslyCreatedChat_WhenNonGlobalChatPassed {
@@ -330,6 +602,44 @@
 }
 
 
+#pragma mark - Tests :: removeChats
+
+- (void)testRemoveChats_ShouldRemovePreviouslyCreatedChats {
+    
+    NSArray<NSString *> *names = @[@"TestChat18", @"TestChat19", @"TestChat20"];
+    
+    
+    NSArray<CENChat *> *chats = [self.manager createChatsWithNames:names group:nil];
+    
+    XCTAssertEqual(self.manager.chats.count, names.count);
+    [self.manager removeChats:chats];
+    XCTAssertEqual(self.manager.chats.count, 0);
+    
+    for (CENChat *chat in chats) {
+        XCTAssertNil([self.manager chatForChannel:chat.channel]);
+    }
+}
+
+- (void)testRemoveChats_ShouldUpdateChannelsIndexOnce_WhenBatchRemoved {
+    
+    NSArray<NSString *> *names = @[@"TestChat21", @"TestChat22", @"TestChat23"];
+    __block NSUInteger indexUpdatesCount = 0;
+    
+    
+    NSArray<CENChat *> *chats = [self.manager createChatsWithNames:names group:nil];
+    
+    id managerMock = [self mockForObject:self.manager];
+    OCMStub([managerMock updateChannelsIndex]).andDo(^(NSInvocation *invocation) {
+        indexUpdatesCount++;
+    });
+    
+    [self.manager removeChats:chats];
+    XCTAssertEqual(self.manager.chats.count, 0);
+    
+    XCTAssertEqual(indexUpdatesCount, 1);
+}
+
+
 #pragma mark - Tests :: handleChatMessage
 
 - (void)testHandleChatMessage_ShouldEmitEvent {
@@ -433,6 +743,58 @@
     OCMVerifyAll(chatMock);
 }
 
+- (void)testHandleChatPresenceEvent_ShouldHandleAllChangesAtOnce_WhenPresenceBatchingEnabled {
+    
+    CENChat *expectedChat = [self.manager createGlobalChat:YES withName:nil group:nil private:NO autoConnect:NO metaData:nil];
+    PNPresenceEventResult *presence = [self presenceEventWithType:@"interval"];
+    
+    
+    id chatMock = [self mockForObject:expectedChat];
+    OCMExpect([[chatMock reject] handleRemoteUsersJoin:[OCMArg any] withStates:[OCMArg any] onStateChange:NO]);
+    id recorded = OCMExpect([chatMock handleRemoteUsersJoin:[OCMArg any] leave:[OCMArg any] disconnect:[OCMArg any]
+                                                stateChange:[OCMArg any] withStates:[OCMArg any]]);
+    [self waitForObject:chatMock recordedInvocationCall:recorded afterBlock:^{
+        [self.manager handleChat:expectedChat presenceEvent:presence.data];
+    }];
+    
+    OCMVerifyAll(chatMock);
+}
+
+- (void)testHandleChatPresenceEvent_ShouldHandleOccupancyChange_WhenChatTracksOccupancy {
+    
+    CENChat *expectedChat = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil
+                                        participantsPolicy:CENChatParticipantsOccupancy];
+    PNPresenceEventResult *presence = [self presenceEventWithType:@"interval"];
+    NSUInteger expectedOccupancy = presence.data.presence.occupancy.unsignedIntegerValue;
+    
+    
+    id chatMock = [self mockForObject:expectedChat];
+    OCMExpect([[chatMock reject] handleRemoteUsersJoin:[OCMArg any] withStates:[OCMArg any] onStateChange:NO]);
+    id recorded = OCMExpect([chatMock handleRemoteOccupancyChange:expectedOccupancy]);
+    [self waitForObject:chatMock recordedInvocationCall:recorded afterBlock:^{
+        [self.manager handleChat:expectedChat presenceEvent:presence.data];
+    }];
+    
+    OCMVerifyAll(chatMock);
+}
+
+- (void)testHandleChatPresenceEvent_ShouldNotCreateUsers_WhenChatTracksOccupancy {
+    
+    CENChat *expectedChat = [self.manager createGlobalChat:NO withName:nil group:nil private:NO autoConnect:NO metaData:nil
+                                        participantsPolicy:CENChatParticipantsOccupancy];
+    PNPresenceEventResult *presence = [self presenceEventWithType:@"interval"];
+    CENUsersManager *usersManager = [CENUsersManager managerForChatEngine:self.client];
+    
+    
+    OCMStub([self.client usersManager]).andReturn(usersManager);
+    
+    id managerMock = [self mockForObject:usersManager];
+    id recorded = OCMExpect([[managerMock reject] createUsersWithUUID:[OCMArg any]]);
+    [self waitForObject:managerMock recordedInvocationNotCall:recorded afterBlock:^{
+        [self.manager handleChat:expectedChat presenceEvent:presence.data];
+    }];
+}
+
 - (void)testHandleChatPresenceEvent_ShouldNotHandleUserInterval_WhenNilChatPassed {
     
     PNPresenceEventResult *presence = [self presenceEventWithType:@"interval"];
@@ -468,6 +830,7 @@
     XCTAssertNil(self.manager.global);
     XCTAssertEqual(self.manager.chats.count, expectedChatsCountAfter);
     XCTAssertNil(self.manager.chats);
+    XCTAssertNil([self.manager chatForChannel:@"Chat1"]);
 }
 
 
@@ -4,13 +4,17 @@
  */
 #import <CENChatEngine/CENChatEngine+ChatPrivate.h>
 #import <CENChatEngine/CENObject+PluginsPrivate.h>
+#import <CENChatEngine/CENEvent+Private.h>
 #import <CENChatEngine/CEPMiddleware+Developer.h>
 #import <CENChatEngine/CENChatEngine+Private.h>
 #import <CENChatEngine/CEPPlugin+Developer.h>
+#import <CENChatEngine/CENMiddlewareProfiler.h>
 #import <CENChatEngine/CENPluginsManager.h>
 #import <CENChatEngine/CENChat+Private.h>
 #import <CENChatEngine/CENUser+Private.h>
+#import <CENChatEngine/CENEventAtom.h>
 #import <CENChatEngine/ChatEngine.h>
+#import "CEDummyOnMiddleware.h"
 #import "CEDummyPlugin.h"
 #import <OCMock/OCMock.h>
 #import "CENTestCase.h"
@@ -39,7 +43,9 @@
 #pragma mark - Middleware
 
 - (nullable NSArray<CEPMiddleware *> *)middlewaresForObject:(CENObject *)object atLocation:(NSString *)location
-                                                   forEvent:(NSString *)event;
+                                                    forAtom:(CENEventAtom *)atom;
+- (NSArray<CEPMiddleware *> *)middlewareChainForObject:(CENObject *)object atLocation:(NSString *)location
+                                               forAtom:(CENEventAtom *)atom;
 
 #pragma mark -
 
@@ -77,6 +83,22 @@
     return YES;
 }
 
+- (CENConfiguration *)configurationForTestCaseWithName:(NSString *)name {
+    
+    CENConfiguration *configuration = [super configurationForTestCaseWithName:name];
+    configuration.profileMiddlewares = [name rangeOfString:@"WhenProfilingEnabled"].location != NSNotFound;
+    
+    if ([name rangeOfString:@"Periodically"].location != NSNotFound) {
+        configuration.middlewareMetricsInterval = 1.f;
+    }
+    
+    if ([name rangeOfString:@"WhenMiddlewareTimedOut"].location != NSNotFound) {
+        configuration.middlewareTimeout = 0.5f;
+    }
+    
+    return configuration;
+}
+
 - (BOOL)shouldSetupVCR {
 
     return NO;
@@ -347,7 +369,7 @@
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
         [self.manager setupProtoPluginsForObject:chat withCompletion:^{
             [self threadSafeManagerDataAccessWith:^{
-                XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forEvent:@"event"]);
+                XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"event"]]);
                 handler();
             }];
         }];
@@ -367,13 +389,140 @@
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
         [self.manager setupProtoPluginsForObject:chat withCompletion:^{
             [self threadSafeManagerDataAccessWith:^{
-                XCTAssertNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.emit forEvent:@"event"]);
+                XCTAssertNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.emit forAtom:[CENEventAtom atomForEvent:@"event"]]);
                 handler();
             }];
         }];
     }];
 }
 
+- (void)testSetupProtoPluginsForObject_ShouldShareMiddleware_WhenProtoPluginSharesEventMiddlewares {
+    
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENEvent class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"$.emitted"] };
+    NSString *identifier = CEDummyPlugin.identifier;
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    CENEvent *event1 = [CENEvent eventWithName:@"message" chat:chat chatEngine:self.client];
+    CENEvent *event2 = [CENEvent eventWithName:@"message" chat:chat chatEngine:self.client];
+    
+    
+    id pluginClassMock = [self mockForObject:[CEDummyPlugin class]];
+    OCMStub([pluginClassMock sharesEventMiddlewares]).andReturn(YES);
+    
+    [self.manager registerProtoPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObjectType:@"Event"];
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager setupProtoPluginsForObject:(id)event1 withCompletion:^{
+            [self.manager setupProtoPluginsForObject:(id)event2 withCompletion:handler];
+        }];
+    }];
+    
+    NSArray<CEPMiddleware *> *middlewares1 = [self.manager middlewareChainForObject:(id)event1
+                                                                          atLocation:CEPMiddlewareLocation.on
+                                                                             forAtom:[CENEventAtom atomForEvent:@"$.emitted"]];
+    NSArray<CEPMiddleware *> *middlewares2 = [self.manager middlewareChainForObject:(id)event2
+                                                                          atLocation:CEPMiddlewareLocation.on
+                                                                             forAtom:[CENEventAtom atomForEvent:@"$.emitted"]];
+    
+    XCTAssertEqual(middlewares1.count, 1);
+    XCTAssertEqual(middlewares1.firstObject, middlewares2.firstObject);
+    XCTAssertNil(middlewares1.firstObject.object);
+    XCTAssertEqual(self.manager.middlewares.count, 0);
+    XCTAssertTrue([self.manager hasPluginWithIdentifier:identifier forObject:(id)event2]);
+}
+
+- (void)testSetupProtoPluginsForObject_ShouldRemoveSharedMiddleware_WhenProtoPluginUnregistered {
+    
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENEvent class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"$.emitted"] };
+    NSString *identifier = CEDummyPlugin.identifier;
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    CENEvent *event = [CENEvent eventWithName:@"message" chat:chat chatEngine:self.client];
+    
+    
+    id pluginClassMock = [self mockForObject:[CEDummyPlugin class]];
+    OCMStub([pluginClassMock sharesEventMiddlewares]).andReturn(YES);
+    
+    [self.manager registerProtoPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObjectType:@"Event"];
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager setupProtoPluginsForObject:(id)event withCompletion:handler];
+    }];
+    
+    XCTAssertEqual([self.manager middlewareChainForObject:(id)event atLocation:CEPMiddlewareLocation.on
+                                                   forAtom:[CENEventAtom atomForEvent:@"$.emitted"]].count, 1);
+    
+    [self.manager unregisterProtoPluginWithIdentifier:identifier forObjectType:@"Event"];
+    
+    XCTAssertEqual([self.manager middlewareChainForObject:(id)event atLocation:CEPMiddlewareLocation.on
+                                                   forAtom:[CENEventAtom atomForEvent:@"$.emitted"]].count, 0);
+    XCTAssertFalse([self.manager hasPluginWithIdentifier:identifier forObject:(id)event]);
+}
+
+
+#pragma mark - Tests :: setupProtoPluginsForObjects
+
+- (void)testSetupProtoPluginsForObjects_ShouldCreateExtensionForEachObject_WhenProtoPluginRegisteredForObjectsType {
+    
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self.manager registerProtoPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObjectType:@"Chat"];
+    NSArray<CENChat *> *chats = @[
+        [self publicChatWithChatEngine:self.client],
+        [self publicChatWithChatEngine:self.client],
+        [self publicChatWithChatEngine:self.client]
+    ];
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager setupProtoPluginsForObjects:chats withCompletion:^{
+            for (CENChat *chat in chats) {
+                XCTAssertNotNil([self.manager extensionForObject:chat withIdentifier:identifier]);
+            }
+            
+            handler();
+        }];
+    }];
+}
+
+- (void)testSetupProtoPluginsForObjects_ShouldNotRegisterPluginForEachObjectSeparately {
+    
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self.manager registerProtoPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObjectType:@"Chat"];
+    NSArray<CENChat *> *chats = @[
+        [self publicChatWithChatEngine:self.client],
+        [self publicChatWithChatEngine:self.client]
+    ];
+    
+    id managerMock = [self mockForObject:self.manager];
+    id recorded = OCMExpect([[managerMock reject] registerPlugin:[OCMArg any] forObject:[OCMArg any] firstInList:NO
+                                           withRegistrationGroup:[OCMArg any]]);
+    [self waitForObject:managerMock recordedInvocationNotCall:recorded afterBlock:^{
+        [self.manager setupProtoPluginsForObjects:chats withCompletion:nil];
+    }];
+}
+
+- (void)testSetupProtoPluginsForObjects_ShouldCallCompletion_WhenEmptyObjectsListPassed {
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager setupProtoPluginsForObjects:@[] withCompletion:handler];
+    }];
+}
+
+- (void)testSetupProtoPluginsForObjects_ShouldThrow_WhenListContainsUknownObject {
+    
+    NSArray *objects = @[[self publicChatWithChatEngine:self.client], @2010];
+    
+    
+    XCTAssertThrowsSpecificNamed([self.manager setupProtoPluginsForObjects:objects withCompletion:^{}], NSException,
+                                 NSInvalidArgumentException);
+}
+
+
 
 #pragma mark - Tests :: unregisterProtoPluginWithIdentifier
 
@@ -396,7 +545,7 @@
     
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
         [self threadSafeManagerDataAccessWith:^{
-            XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forEvent:@"event"]);
+            XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"event"]]);
             handler();
         }];
     }];
@@ -413,7 +562,7 @@
     
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
         [self threadSafeManagerDataAccessWith:^{
-            XCTAssertNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.emit forEvent:@"event"]);
+            XCTAssertNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.emit forAtom:[CENEventAtom atomForEvent:@"event"]]);
             handler();
         }];
     }];
@@ -483,7 +632,7 @@
     
     [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
         [self threadSafeManagerDataAccessWith:^{
-            XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forEvent:@"event"]);
+            XCTAssertNotNil([self.manager middlewaresForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"event"]]);
             handler();
         }];
     }];
@@ -788,6 +937,32 @@
 }
 
 
+#pragma mark - Tests :: unregisterAllFromObjectWithIdentifier
+
+- (void)testUnregisterAllFromObjectWithIdentifier_ShouldRemovePlugins_WhenObjectWithIdentifierHasPlugins {
+    
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat firstInList:NO
+                      completion:nil];
+    [self.manager unregisterAllFromObjectWithIdentifier:chat.identifier];
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        XCTAssertNil([self.manager extensionForObject:chat withIdentifier:identifier]);
+        handler();
+    }];
+}
+
+- (void)testUnregisterAllFromObjectWithIdentifier_ShouldThrow_WhenInvalidIdentifierPassed {
+    
+    XCTAssertThrowsSpecificNamed([self.manager unregisterAllFromObjectWithIdentifier:(id)@2010], NSException,
+                                 NSInvalidArgumentException);
+}
+
+
 #pragma mark - Tests :: extensionForObject
 
 - (void)testExtensionForObject_ShouldReceiveExtensionExecutionContext_WhenPluginRegisteredForObject {
@@ -825,6 +1000,80 @@
     }];
 }
 
+- (void)testExtensionForObject_ShouldNotWaitForResourceAccessQueue_WhenObjectPluginsNotModified {
+    
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_async(self.manager.resourceAccessQueue, ^{
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+    });
+    
+    XCTAssertNotNil([self.manager extensionForObject:chat withIdentifier:identifier]);
+    XCTAssertTrue([self.manager hasPluginWithIdentifier:identifier forObject:chat]);
+    dispatch_semaphore_signal(semaphore);
+}
+
+- (void)testExtensionForObject_ShouldReturnNil_WhenPluginUnregisteredFromObject {
+    
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    [self.manager unregisterObjects:chat pluginWithIdentifier:identifier];
+    
+    XCTAssertNil([self.manager extensionForObject:chat withIdentifier:identifier]);
+    XCTAssertFalse([self.manager hasPluginWithIdentifier:identifier forObject:chat]);
+}
+
+- (void)testPerformance_ExtensionForObject_WhenExtensionsRequestedConcurrentlyForDifferentChats {
+    
+    dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    CEDummyPlugin.classesWithExtensions = @[[CENChat class]];
+    NSString *identifier = CEDummyPlugin.identifier;
+    NSMutableArray<CENChat *> *chats = [NSMutableArray new];
+    NSUInteger threadsCount = 8;
+    
+    
+    for (NSUInteger chatIdx = 0; chatIdx < threadsCount; chatIdx++) {
+        CENChat *chat = [self publicChatWithChatEngine:self.client];
+        [chats addObject:chat];
+        
+        [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+            [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil
+                               forObject:chat firstInList:NO completion:handler];
+        }];
+    }
+    
+    [self measureBlock:^{
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (CENChat *chat in chats) {
+            dispatch_group_async(group, queue, ^{
+                for (NSUInteger lookupIdx = 0; lookupIdx < 10000; lookupIdx++) {
+                    [self.manager extensionForObject:chat withIdentifier:identifier];
+                }
+            });
+        }
+        
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    }];
+}
+
 - (void)testExtensionForObject_ShouldThrow_WhenNonNSStringNilIdentifierPassed {
     
     CENChat *chat = [self publicChatWithChatEngine:self.client];
@@ -915,6 +1164,152 @@
     }];
 }
 
+- (void)testRunMiddlewaresAtLocation_ShouldReuseResolvedChain_WhenCalledFewTimesForSameEvent {
+    
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    NSArray *chain = [self.manager middlewareChainForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"test"]];
+    
+    XCTAssertEqual(chain.count, 1);
+    XCTAssertEqual([self.manager middlewareChainForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"test"]], chain);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldResolveChainAgain_WhenPluginRegisteredForObject {
+    
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    NSString *identifier2 = [CEDummyPlugin.identifier stringByAppendingString:@"2"];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier1 = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier1 configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    XCTAssertEqual([self.manager middlewareChainForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"test"]].count, 1);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier2 configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    XCTAssertEqual([self.manager middlewareChainForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"test"]].count, 2);
+    
+    [self.manager unregisterObjects:chat pluginWithIdentifier:identifier1];
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    
+    XCTAssertEqual([self.manager middlewareChainForObject:chat atLocation:CEPMiddlewareLocation.on forAtom:[CENEventAtom atomForEvent:@"test"]].count, 1);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldProcessWithoutContinuation_WhenMiddlewareIsSynchronous {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    __block BOOL handlerCalled = NO;
+    
+    
+    id middlewareClassMock = [self mockForObject:[CEDummyOnMiddleware class]];
+    OCMStub([middlewareClassMock isSynchronous]).andReturn(YES);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMExpect([middlewareMock processEvent:@"test" withData:[OCMArg any]]).andForwardToRealObject();
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                    XCTAssertFalse(rejected);
+                                    XCTAssertNotNil(data[@"broadcast"]);
+                                    handlerCalled = YES;
+                                }];
+    
+    XCTAssertTrue(handlerCalled);
+    OCMVerifyAll(middlewareMock);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldNotProcessInLoop_WhenMiddlewareIsAsynchronous {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMExpect([[middlewareMock reject] processEvent:[OCMArg any] withData:[OCMArg any]]);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                    completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                        XCTAssertNotNil(data[@"broadcast"]);
+                                        handler();
+                                    }];
+    }];
+    
+    OCMVerifyAll(middlewareMock);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldStopProcessing_WhenSynchronousMiddlewareRejectsPayload {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    NSString *identifier2 = [CEDummyPlugin.identifier stringByAppendingString:@"2"];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier1 = CEDummyPlugin.identifier;
+    __block BOOL handlerCalled = NO;
+    
+    
+    id middlewareClassMock = [self mockForObject:[CEDummyOnMiddleware class]];
+    OCMStub([middlewareClassMock isSynchronous]).andReturn(YES);
+    
+    [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier1 configuration:nil forObject:chat firstInList:NO
+                      completion:nil];
+    [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier2 configuration:nil forObject:chat firstInList:NO
+                      completion:nil];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id firstMiddlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    id lastMiddlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].lastObject];
+    OCMStub([firstMiddlewareMock processEvent:[OCMArg any] withData:[OCMArg any]]).andReturn(YES);
+    OCMExpect([[lastMiddlewareMock reject] processEvent:[OCMArg any] withData:[OCMArg any]]);
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                    XCTAssertTrue(rejected);
+                                    XCTAssertNil(data);
+                                    handlerCalled = YES;
+                                }];
+    
+    XCTAssertTrue(handlerCalled);
+    OCMVerifyAll(lastMiddlewareMock);
+}
+
 - (void)testRunMiddlewaresAtLocation_ShouldThrow_WhenNonNSStringEventPassed {
     
     CENChat *chat = [self publicChatWithChatEngine:self.client];
@@ -1032,6 +1427,287 @@
                                  NSException, NSInvalidArgumentException);
 }
 
+- (void)testRunMiddlewaresAtLocation_ShouldContinueProcessing_WhenMiddlewareTimedOut {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    NSString *identifier2 = [CEDummyPlugin.identifier stringByAppendingString:@"2"];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier1 = CEDummyPlugin.identifier;
+    
+    
+    [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier1 configuration:nil forObject:chat firstInList:NO
+                      completion:nil];
+    [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier2 configuration:nil forObject:chat firstInList:NO
+                      completion:nil];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMStub([middlewareMock runForEvent:[OCMArg any] withData:[OCMArg any] completion:[OCMArg any]]);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                    completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                        XCTAssertFalse(rejected);
+                                        XCTAssertNotNil(data[@"broadcast"]);
+                                        handler();
+                                    }];
+    }];
+    
+    XCTAssertEqual(self.manager.middlewareTimeoutsCount, 1);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldEmitError_WhenMiddlewareTimedOut {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMStub([middlewareMock runForEvent:[OCMArg any] withData:[OCMArg any] completion:[OCMArg any]]);
+    
+    [self object:self.client shouldHandleEvent:@"$.error.middleware.timeout"
+     withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            NSError *error = emittedEvent.data;
+            
+            XCTAssertEqual(error.code, kCENMiddlewareTimeoutError);
+            handler();
+        };
+    } afterBlock:^{
+        [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                    completion:^(BOOL rejected, NSMutableDictionary *data) { }];
+    }];
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldIgnoreLateCompletion_WhenMiddlewareTimedOut {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    __block NSUInteger completionsCount = 0;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMStub([middlewareMock runForEvent:[OCMArg any] withData:[OCMArg any] completion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            void(^handlerBlock)(BOOL) = [self objectForInvocation:invocation argumentAtIndex:3];
+            
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(1.f * NSEC_PER_SEC)),
+                           dispatch_get_main_queue(), ^{
+                handlerBlock(YES);
+            });
+        });
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                    XCTAssertFalse(rejected);
+                                    completionsCount++;
+                                }];
+    
+    [self waitTask:@"lateMiddlewareCompletion" completionFor:(self.testCompletionDelay + 1.f)];
+    
+    XCTAssertEqual(completionsCount, 1);
+}
+
+- (void)testRunMiddlewaresAtLocation_ShouldNotShareLateMiddlewareChanges_WhenMiddlewareTimedOut {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    __block NSMutableDictionary *processedPayload = nil;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMStub([middlewareMock runForEvent:[OCMArg any] withData:[OCMArg any] completion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            NSMutableDictionary *data = [self objectForInvocation:invocation argumentAtIndex:2];
+            
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(1.f * NSEC_PER_SEC)),
+                           dispatch_get_main_queue(), ^{
+                data[@"late"] = @YES;
+            });
+        });
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) {
+                                    processedPayload = data;
+                                }];
+    
+    [self waitTask:@"lateMiddlewareChange" completionFor:(self.testCompletionDelay + 1.f)];
+    
+    XCTAssertNotNil(processedPayload);
+    XCTAssertNil(processedPayload[@"late"]);
+    XCTAssertNil(payload[@"late"]);
+}
+
+
+#pragma mark - Tests :: middlewareMetrics
+
+- (void)testMiddlewareMetrics_ShouldCollectInvocations_WhenProfilingEnabled {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    for (NSUInteger attempt = 0; attempt < 2; attempt++) {
+        [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"TEST" object:chat withPayload:payload
+                                    completion:^(BOOL rejected, NSMutableDictionary *data) { }];
+    }
+    
+    NSArray<NSDictionary *> *metrics = [self.manager middlewareMetrics];
+    NSNumber *histogramCount = [metrics.firstObject[CENMiddlewareMetrics.histogram] valueForKeyPath:@"@sum.self"];
+    
+    XCTAssertEqual(metrics.count, 1);
+    XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.identifier], identifier);
+    XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.location], CEPMiddlewareLocation.on);
+    XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.event], @"test");
+    XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.invocations], @2);
+    XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.rejections], @0);
+    XCTAssertEqualObjects(histogramCount, @2);
+}
+
+- (void)testMiddlewareMetrics_ShouldCountRejections_WhenProfilingEnabled {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    dispatch_sync(self.manager.resourceAccessQueue, ^{});
+    id middlewareMock = [self mockForObject:self.manager.middlewares[chat.identifier].firstObject];
+    OCMStub([middlewareMock runForEvent:[OCMArg any] withData:[OCMArg any] completion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            void(^handlerBlock)(BOOL) = [self objectForInvocation:invocation argumentAtIndex:3];
+            handlerBlock(YES);
+        });
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) { }];
+    
+    NSDictionary *metrics = [self.manager middlewareMetrics].firstObject;
+    
+    XCTAssertEqualObjects(metrics[CENMiddlewareMetrics.invocations], @1);
+    XCTAssertEqualObjects(metrics[CENMiddlewareMetrics.rejections], @1);
+}
+
+- (void)testMiddlewareMetrics_ShouldEmitMetricsPeriodically_WhenProfilingEnabled {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    [self object:self.client shouldHandleEvent:@"$.metrics.middleware" withinInterval:2.f
+     withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            NSArray<NSDictionary *> *metrics = emittedEvent.data;
+            
+            XCTAssertEqualObjects(metrics.firstObject[CENMiddlewareMetrics.identifier], identifier);
+            handler();
+        };
+    } afterBlock:^{
+        [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                    completion:^(BOOL rejected, NSMutableDictionary *data) { }];
+    }];
+}
+
+- (void)testMiddlewareMetrics_ShouldReturnEmptyList_WhenProfilingDisabled {
+    
+    NSMutableDictionary *payload = [NSMutableDictionary dictionaryWithDictionary:@{ @"test": @"payload" }];
+    CEDummyPlugin.middlewareLocationClasses = @{ CEPMiddlewareLocation.on: @[[CENChat class]] };
+    CEDummyPlugin.middlewareLocationEvents = @{ CEPMiddlewareLocation.on: @[@"test"] };
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    NSString *identifier = CEDummyPlugin.identifier;
+    
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.manager registerPlugin:[CEDummyPlugin class] withIdentifier:identifier configuration:nil forObject:chat
+                         firstInList:NO completion:handler];
+    }];
+    
+    [self.manager runMiddlewaresAtLocation:CEPMiddlewareLocation.on forEvent:@"test" object:chat withPayload:payload
+                                completion:^(BOOL rejected, NSMutableDictionary *data) { }];
+    
+    XCTAssertEqual([self.manager middlewareMetrics].count, 0);
+}
+
+- (void)testMiddlewareMetrics_ShouldAggregateOverflowEvents_WhenTooManyEventNamesProfiled {
+    
+    CENMiddlewareProfiler *profiler = [CENMiddlewareProfiler profiler];
+    NSString *identifier = CEDummyPlugin.identifier;
+    NSUInteger eventsCount = 1000;
+    
+    
+    for (NSUInteger eventIdx = 0; eventIdx < eventsCount; eventIdx++) {
+        NSString *event = [NSString stringWithFormat:@"event-%@", @(eventIdx)];
+        
+        [profiler recordMiddlewareWithIdentifier:identifier
+                                      atLocation:CEPMiddlewareLocation.on
+                                        forEvent:event
+                                       startedAt:[CENMiddlewareProfiler timestamp]
+                                        rejected:NO];
+    }
+    
+    NSArray<NSDictionary *> *metrics = [profiler snapshot];
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K = %@", CENMiddlewareMetrics.event, @"other"];
+    NSDictionary *overflowMetrics = [metrics filteredArrayUsingPredicate:predicate].firstObject;
+    NSNumber *invocationsCount = [metrics valueForKeyPath:[@"@sum." stringByAppendingString:CENMiddlewareMetrics.invocations]];
+    
+    XCTAssertEqual(metrics.count, 101);
+    XCTAssertNotNil(overflowMetrics);
+    XCTAssertEqualObjects(overflowMetrics[CENMiddlewareMetrics.invocations], @(eventsCount - 100));
+    XCTAssertEqualObjects(invocationsCount, @(eventsCount));
+}
+
 
 #pragma mark - Tests :: destroy
 
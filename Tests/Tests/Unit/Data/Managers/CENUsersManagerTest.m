@@ -5,6 +5,7 @@
 #import <CENChatEngine/CENChatEngine+Private.h>
 #import <CENChatEngine/CENChatEngine+PluginsPrivate.h>
 #import <CENChatEngine/CENChatEngine+PubNubPrivate.h>
+#import <CENChatEngine/CENChatEngine+ChatPrivate.h>
 #import <CENChatEngine/CENChat+Interface.h>
 #import <CENChatEngine/CENChat+Private.h>
 #import <CENChatEngine/CENUser+Private.h>
@@ -57,6 +58,17 @@
     return [name rangeOfString:@"GlobalChatNotEnabled"].location == NSNotFound;
 }
 
+- (CENConfiguration *)configurationForTestCaseWithName:(NSString *)name {
+    
+    CENConfiguration *configuration = [super configurationForTestCaseWithName:name];
+    
+    if ([name rangeOfString:@"WhenCapacityLimited"].location != NSNotFound) {
+        configuration.maximumUsersCount = 10;
+    }
+    
+    return configuration;
+}
+
 - (void)setUp {
     
     [super setUp];
@@ -231,6 +243,57 @@
     }];
 }
 
+- (void)testCreateUserWithUUID_ShouldCreateSingleUser_WhenCalledConcurrentlyForSameUUID {
+    
+    NSMutableSet<CENUser *> *users = [NSMutableSet new];
+    NSLock *usersLock = [NSLock new];
+    
+    
+    dispatch_apply(100, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t __unused iteration) {
+        CENUser *user = [self.manager createUserWithUUID:@"User-1" state:nil];
+        
+        [usersLock lock];
+        [users addObject:user];
+        [usersLock unlock];
+    });
+    
+    XCTAssertEqual(users.count, 1);
+}
+
+- (void)testPerformance_CreateUserWithUUID_WhenChatsReceiveEventsFromKnownSenders {
+    
+    NSUInteger const chatsCount = 50;
+    NSUInteger const eventsCount = 200;
+    NSMutableArray<NSString *> *senders = [NSMutableArray new];
+    NSMutableArray<dispatch_queue_t> *chatQueues = [NSMutableArray new];
+    
+    
+    for (NSUInteger senderIdx = 0; senderIdx < 20; senderIdx++) {
+        [senders addObject:[NSString stringWithFormat:@"Sender-%@", @(senderIdx)]];
+    }
+    
+    for (NSUInteger chatIdx = 0; chatIdx < chatsCount; chatIdx++) {
+        NSString *label = [NSString stringWithFormat:@"com.chatengine.test.chat-%@", @(chatIdx)];
+        [chatQueues addObject:dispatch_queue_create(label.UTF8String, DISPATCH_QUEUE_SERIAL)];
+    }
+    
+    [self.manager createUsersWithUUID:senders];
+    
+    [self measureBlock:^{
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (dispatch_queue_t chatQueue in chatQueues) {
+            dispatch_group_async(group, chatQueue, ^{
+                for (NSUInteger eventIdx = 0; eventIdx < eventsCount; eventIdx++) {
+                    [self.manager createUserWithUUID:senders[eventIdx % senders.count] state:@{}];
+                }
+            });
+        }
+        
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    }];
+}
+
 
 #pragma mark - Tests :: createUsersWithUUID
 
@@ -245,6 +308,80 @@
     XCTAssertEqualObjects([users valueForKey:@"uuid"], uuids);
 }
 
+- (void)testCreateUsersWithUUID_ShouldReturnUsersInInputOrder_WhenSomeUsersAlreadyCreated {
+    
+    NSArray<NSString *> *uuids = @[@"User-3", @"User-1", @"User-2", @"User-1"];
+    
+    
+    CENUser *existingUser = [self.manager createUserWithUUID:@"User-2" state:nil];
+    NSArray<CENUser *> *users = [self.manager createUsersWithUUID:uuids];
+    
+    XCTAssertEqualObjects([users valueForKey:@"uuid"], uuids);
+    XCTAssertEqual(users[2], existingUser);
+    XCTAssertEqual(users[1], users[3]);
+    XCTAssertEqual(self.manager.users.count, 3);
+}
+
+- (void)testCreateUsersWithUUID_ShouldSkipInvalidUUIDs {
+    
+    NSArray *uuids = @[@"User-1", @2010, @"", @"User-2"];
+    
+    
+    NSArray<CENUser *> *users = [self.manager createUsersWithUUID:uuids];
+    
+    XCTAssertEqualObjects([users valueForKey:@"uuid"], (@[@"User-1", @"User-2"]));
+}
+
+- (void)testCreateUsersWithUUID_ShouldReturnNil_WhenOnlyInvalidUUIDsPassed {
+    
+    XCTAssertNil([self.manager createUsersWithUUID:(id)@[@2010, @""]]);
+}
+
+- (void)testPerformance_CreateUsersWithUUID_WhenHundredsOfUUIDsPassed {
+    
+    NSMutableArray<NSString *> *uuids = [NSMutableArray new];
+    
+    for (NSUInteger idx = 0; idx < 500; idx++) {
+        [uuids addObject:[NSUUID UUID].UUIDString];
+    }
+    
+    
+    [self measureBlock:^{
+        [self.manager createUsersWithUUID:uuids];
+    }];
+}
+
+- (void)testCreateUsersWithUUID_ShouldSetupProtoPluginsForCreatedUsersAtOnce {
+    
+    NSArray<NSString *> *uuids = @[@"User-1", @"User-2", @"User-3"];
+    
+    
+    OCMExpect([[(id)self.client reject] setupProtoPluginsForObject:[OCMArg any] withCompletion:[OCMArg any]]);
+    id recorded = OCMExpect([(id)self.client setupProtoPluginsForObjects:[OCMArg checkWithBlock:^BOOL(NSArray *users) {
+        return [[users valueForKey:@"uuid"] isEqualToArray:uuids];
+    }] withCompletion:[OCMArg any]]);
+    [self waitForObject:self.client recordedInvocationCall:recorded afterBlock:^{
+        [self.manager createUsersWithUUID:uuids];
+    }];
+    
+    OCMVerifyAll((id)self.client);
+}
+
+- (void)testCreateUsersWithUUID_ShouldSetupProtoPluginsOnlyForNewUsers {
+    
+    NSArray<NSString *> *uuids = @[@"User-1", @"User-2"];
+    
+    
+    [self.manager createUserWithUUID:uuids.firstObject state:nil];
+    
+    id recorded = OCMExpect([(id)self.client setupProtoPluginsForObjects:[OCMArg checkWithBlock:^BOOL(NSArray *users) {
+        return [[users valueForKey:@"uuid"] isEqualToArray:@[uuids.lastObject]];
+    }] withCompletion:[OCMArg any]]);
+    [self waitForObject:self.client recordedInvocationCall:recorded afterBlock:^{
+        [self.manager createUsersWithUUID:uuids];
+    }];
+}
+
 
 #pragma mark - Tests :: userWithUUID
 
@@ -291,6 +428,120 @@
 }
 
 
+#pragma mark - Tests :: Eviction
+
+- (void)testCreateUserWithUUID_ShouldEvictLeastRecentlyUsedUsers_WhenCapacityLimited {
+    
+    // Mocked client record invocations (with arguments), so users will be retained by it.
+    CENChatEngine *client = [self createChatEngineWithConfiguration:[self configurationForTestCaseWithName:self.name]];
+    CENUsersManager *manager = [CENUsersManager managerForChatEngine:client];
+    
+    
+    @autoreleasepool {
+        for (NSUInteger userIdx = 0; userIdx < 10; userIdx++) {
+            [manager createUserWithUUID:[NSString stringWithFormat:@"User-%@", @(userIdx)] state:nil];
+        }
+    }
+    
+    [self waitTask:@"waitProtoPluginsSetup" completionFor:self.delayedCheck];
+    [manager userWithUUID:@"User-0"];
+    
+    @autoreleasepool {
+        [manager createUserWithUUID:@"User-10" state:nil];
+    }
+    
+    [self waitTask:@"waitUsersEviction" completionFor:self.delayedCheck];
+    
+    XCTAssertNotNil([manager userWithUUID:@"User-0"]);
+    XCTAssertNil([manager userWithUUID:@"User-1"]);
+    XCTAssertNil([manager userWithUUID:@"User-2"]);
+    XCTAssertNotNil([manager userWithUUID:@"User-10"]);
+    XCTAssertEqualObjects([manager metrics][CENUsersMetrics.count], @9);
+    XCTAssertEqualObjects([manager metrics][CENUsersMetrics.evictions], @2);
+    
+    [manager destroy];
+}
+
+- (void)testCreateUserWithUUID_ShouldRemoveEvictedUserChats_WhenCapacityLimited {
+    
+    // Mocked client record invocations (with arguments), so users will be retained by it.
+    CENChatEngine *client = [self createChatEngineWithConfiguration:[self configurationForTestCaseWithName:self.name]];
+    CENUsersManager *manager = [CENUsersManager managerForChatEngine:client];
+    NSString *directChatName = [client nameOfChatForUserWithUUID:@"User-0" direct:YES];
+    NSString *feedChatName = [client nameOfChatForUserWithUUID:@"User-0" direct:NO];
+    
+    
+    @autoreleasepool {
+        for (NSUInteger userIdx = 0; userIdx < 10; userIdx++) {
+            CENUser *user = [manager createUserWithUUID:[NSString stringWithFormat:@"User-%@", @(userIdx)] state:nil];
+            
+            if (userIdx == 0) {
+                XCTAssertNotNil(user.direct);
+                XCTAssertNotNil(user.feed);
+            }
+        }
+    }
+    
+    [self waitTask:@"waitProtoPluginsSetup" completionFor:self.delayedCheck];
+    XCTAssertNotNil([client.chatsManager chatWithName:directChatName private:NO]);
+    XCTAssertNotNil([client.chatsManager chatWithName:feedChatName private:NO]);
+    
+    @autoreleasepool {
+        [manager createUserWithUUID:@"User-10" state:nil];
+    }
+    
+    [self waitTask:@"waitUsersEviction" completionFor:self.delayedCheck];
+    
+    XCTAssertNil([manager userWithUUID:@"User-0"]);
+    XCTAssertNil([client.chatsManager chatWithName:directChatName private:NO]);
+    XCTAssertNil([client.chatsManager chatWithName:feedChatName private:NO]);
+    
+    [manager destroy];
+}
+
+- (void)testCreateUserWithUUID_ShouldNotEvictUsers_WhenCapacityLimitedAndUsersRetainedElsewhere {
+    
+    NSMutableArray<CENUser *> *users = [NSMutableArray new];
+    
+    
+    for (NSUInteger userIdx = 0; userIdx < 11; userIdx++) {
+        [users addObject:[self.manager createUserWithUUID:[NSString stringWithFormat:@"User-%@", @(userIdx)] state:nil]];
+    }
+    
+    [self waitTask:@"waitUsersEviction" completionFor:self.delayedCheck];
+    
+    XCTAssertEqual([self.manager userWithUUID:@"User-0"], users.firstObject);
+    XCTAssertEqualObjects([self.manager metrics][CENUsersMetrics.count], @11);
+    XCTAssertEqualObjects([self.manager metrics][CENUsersMetrics.evictions], @0);
+}
+
+- (void)testCreateUserWithUUID_ShouldNotEvictUsers_WhenCapacityNotLimited {
+    
+    OCMExpect([[(id)self.client reject] unregisterAllPluginsFromObjectWithIdentifier:[OCMArg any]]);
+    
+    for (NSUInteger userIdx = 0; userIdx < 20; userIdx++) {
+        [self.manager createUserWithUUID:[NSString stringWithFormat:@"User-%@", @(userIdx)] state:nil];
+    }
+    
+    [self waitTask:@"waitUsersEviction" completionFor:self.delayedCheck];
+    
+    XCTAssertEqualObjects([self.manager metrics][CENUsersMetrics.count], @20);
+    OCMVerifyAll((id)self.client);
+}
+
+
+#pragma mark - Tests :: metrics
+
+- (void)testMetrics_ShouldReportUsersCountAndCapacity_WhenCapacityLimited {
+    
+    [self.manager createUsersWithUUID:@[@"User-1", @"User-2"]];
+    NSDictionary<NSString *, NSNumber *> *metrics = [self.manager metrics];
+    
+    XCTAssertEqualObjects(metrics[CENUsersMetrics.count], @2);
+    XCTAssertEqualObjects(metrics[CENUsersMetrics.capacity], @10);
+    XCTAssertEqualObjects(metrics[CENUsersMetrics.evictions], @0);
+}
+
 #pragma mark - Misc
 
 - (void)threadSafeObjectData:(CENObject *)object accessWith:(dispatch_block_t)block {
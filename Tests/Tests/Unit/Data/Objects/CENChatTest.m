@@ -176,7 +176,8 @@
     
     NSString *nspace = nil;
     CENChat *chat = [CENChat chatWithName:@"test" namespace:nspace group:CENChatGroup.custom
-                                  private:NO metaData:@{} chatEngine:self.client];
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsUsers chatEngine:self.client];
     
     
     XCTAssertNil(chat);
@@ -186,7 +187,8 @@
     
     NSString *nspace = @"";
     CENChat *chat = [CENChat chatWithName:@"test" namespace:nspace group:CENChatGroup.custom
-                                  private:NO metaData:@{} chatEngine:self.client];
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsUsers chatEngine:self.client];
     
     
     XCTAssertNil(chat);
@@ -196,7 +198,8 @@
     
     NSString *nspace = (id)@2010;
     CENChat *chat = [CENChat chatWithName:@"test" namespace:nspace group:CENChatGroup.custom
-                                  private:NO metaData:@{} chatEngine:self.client];
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsUsers chatEngine:self.client];
     
     XCTAssertNil(chat);
 }
@@ -223,7 +226,8 @@
     
     NSString *group = (id)@2010;
     CENChat *chat = [CENChat chatWithName:@"test" namespace:@"test" group:group
-                                  private:NO metaData:@{} chatEngine:self.client];
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsUsers chatEngine:self.client];
  
     
     XCTAssertNil(chat);
@@ -240,7 +244,8 @@
     
     CENChatEngine *client = (id)@2010;
     CENChat *chat = [CENChat chatWithName:@"test" namespace:@"test" group:CENChatGroup.custom
-                                  private:NO metaData:@{} chatEngine:client];
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsUsers chatEngine:client];
     
     
     XCTAssertNil(chat);
@@ -263,6 +268,28 @@
     XCTAssertTrue(chat.plugin([CENSenderAugmentationPlugin class]).exists());
 }
 
+- (void)testConstructor_ShouldTrackUsers_WhenCreatedWithDefaultPolicy {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:@{}];
+    
+    
+    XCTAssertEqual(chat.participantsPolicy, CENChatParticipantsUsers);
+    XCTAssertEqual(chat.occupancy, 0);
+}
+
+- (void)testConstructor_ShouldTrackOccupancy_WhenCreatedWithOccupancyPolicy {
+    
+    CENChat *chat = [CENChat chatWithName:@"test" namespace:@"test" group:CENChatGroup.custom
+                                  private:NO metaData:@{}
+                       participantsPolicy:CENChatParticipantsOccupancy chatEngine:self.client];
+    
+    
+    XCTAssertEqual(chat.participantsPolicy, CENChatParticipantsOccupancy);
+    XCTAssertEqual(chat.occupancy, 0);
+    
+    [chat destruct];
+}
+
 
 #pragma mark - Tests :: objectType
 
@@ -448,7 +475,7 @@
     id chatMock = [self mockForObject:chat];
     OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
     
-    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
         dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
         
         block();
@@ -483,7 +510,7 @@
 
     XCTAssertTrue([self isObjectMocked:self.client]);
 
-    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
         CENChat *chatFromInvocation = [self objectForInvocation:invocation argumentAtIndex:1];
         dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
         
@@ -510,7 +537,7 @@
     id chatMock = [self mockForObject:chat];
     OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
     
-    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
         CENChat *chatFromInvocation = [self objectForInvocation:invocation argumentAtIndex:1];
         dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
         
@@ -535,7 +562,7 @@
     id chatMock = [self mockForObject:chat];
     OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
     
-    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
         CENChat *chatFromInvocation = [self objectForInvocation:invocation argumentAtIndex:1];
         dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
         
@@ -559,7 +586,7 @@
     id chatMock = [self mockForObject:chat];
     OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
     
-    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any]]).andDo(nil);
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(nil);
 
     id recorded = OCMExpect([[chatMock reject] emitEventLocally:@"$.connected" withParameters:@[]]);
     [self waitForObject:chatMock recordedInvocationNotCall:recorded withinInterval:2.f afterBlock:^{
@@ -577,7 +604,7 @@
     id chatMock = [self mockForObject:chat];
     OCMStub([(CENChat *)chatMock asleep]).andReturn(NO);
     
-    id recorded = OCMExpect([[(id)self.client reject] handshakeChatAccess:chat withCompletion:[OCMArg any]]);
+    id recorded = OCMExpect([[(id)self.client reject] handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]);
     [self waitForObject:chatMock recordedInvocationNotCall:recorded withinInterval:2.f afterBlock:^{
         XCTAssertNoThrow([chatMock wake]);
     }];
@@ -594,12 +621,93 @@
     OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
     OCMStub([(CENChat *)chatMock hasConnected]).andReturn(YES);
     
-    id recorded = OCMExpect([[(id)self.client reject] handshakeChatAccess:chat withCompletion:[OCMArg any]]);
+    id recorded = OCMExpect([[(id)self.client reject] handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]);
     [self waitForObject:chatMock recordedInvocationNotCall:recorded withinInterval:2.f afterBlock:^{
         XCTAssertNoThrow([chatMock wake]);
     }];
 }
 
+- (void)testWake_ShouldNotRefreshParticipantsList_WhenParticipantsListSynchronized {
+    
+    CENChat *chat = [self privateChatWithChatEngine:self.client];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    [chat handleRemoteUsersRefresh:@[] withStates:@{}];
+    
+    id chatMock = [self mockForObject:chat];
+    OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
+    
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
+        block();
+    });
+    
+    id recorded = OCMExpect([(CENChat *)[chatMock reject] fetchParticipants]);
+    [self waitForObject:chatMock recordedInvocationNotCall:recorded withinInterval:2.f afterBlock:^{
+        [chat wake];
+    }];
+}
+
+
+#pragma mark - Tests :: wakeWithCompletion
+
+- (void)testWakeWithCompletion_ShouldCallCompletion_WhenHandshakeCompleted {
+    
+    CENChat *chat = [self privateChatWithChatEngine:self.client];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    id chatMock = [self mockForObject:chat];
+    OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
+    
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        dispatch_block_t block = [self objectForInvocation:invocation argumentAtIndex:2];
+        block();
+    });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [chat wakeWithCompletion:handler];
+    }];
+}
+
+- (void)testWakeWithCompletion_ShouldCallCompletion_WhenHandshakeFailed {
+    
+    CENChat *chat = [self privateChatWithChatEngine:self.client];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    id chatMock = [self mockForObject:chat];
+    OCMStub([(CENChat *)chatMock asleep]).andReturn(YES);
+    
+    OCMStub([self.client handshakeChatAccess:chat withCompletion:[OCMArg any] failure:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        dispatch_block_t failure = [self objectForInvocation:invocation argumentAtIndex:3];
+        failure();
+    });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [chat wakeWithCompletion:handler];
+    }];
+}
+
+- (void)testWakeWithCompletion_ShouldCallCompletion_WhenNotAsleep {
+    
+    CENChat *chat = [self privateChatWithChatEngine:self.client];
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    id chatMock = [self mockForObject:chat];
+    OCMStub([(CENChat *)chatMock asleep]).andReturn(NO);
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [chat wakeWithCompletion:handler];
+    }];
+}
+
 
 #pragma mark - Tests :: setState
 
@@ -752,6 +860,32 @@
     }];
 }
 
+- (void)testHandlePresenceEvent_ShouldEmitState_WhenRefreshedUsersListContainNewWithState {
+    
+    self.usesMockedObjects = YES;
+    NSString *expectedUserUUID = @"test-user";
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:expectedUserUUID state:@{} chatEngine:self.client];
+    NSDictionary *expectedState = @{ @"test": @"value" };
+    
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    OCMStub([self.client global]).andReturn(chat);
+    
+    [self object:chat shouldHandleEvent:@"$.state" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            CENUser *userWithUpdate = emittedEvent.data;
+            
+            XCTAssertEqualObjects(userWithUpdate.uuid, expectedUserUUID);
+            XCTAssertEqualObjects(userWithUpdate.state, expectedState);
+            
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersRefresh:@[user] withStates:@{ user.uuid: expectedState }];
+    }];
+}
+
 - (void)testHandlePresenceEvent_ShouldNotEmitOnlineHereButEmitState_WhenRefreshedUsersListContainExisting {
     
     self.usesMockedObjects = YES;
@@ -777,6 +911,89 @@
     }];
 }
 
+- (void)testHandlePresenceEvent_ShouldEmitOfflineLeave_WhenRefreshedUsersListDoesNotContainExisting {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    
+    
+    [chat handleRemoteUsersRefresh:@[user] withStates:@{}];
+    [chat handleDisconnection];
+    
+    [self object:chat shouldHandleEvent:@"$.offline.leave" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            XCTAssertEqualObjects(emittedEvent.data, user);
+            XCTAssertNil(chat.users[user.uuid]);
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersRefresh:@[] withStates:@{}];
+    }];
+}
+
+- (void)testHandlePresenceEvent_ShouldNotRemoveUser_WhenUserJoinedAfterUsersListRequest {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    
+    
+    [self object:chat shouldNotHandleEvent:@"$.offline.leave" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersJoin:@[user] withStates:@{} onStateChange:NO];
+        [chat handleRemoteUsersRefresh:@[] withStates:@{}];
+    }];
+    
+    XCTAssertNotNil(chat.users[user.uuid]);
+}
+
+- (void)testHandlePresenceEvent_ShouldNotRemoveUser_WhenUserJoinedDuringManualUsersListRefresh {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    
+    OCMStub([self.client fetchParticipantsForChat:chat]);
+    [chat handleRemoteUsersRefresh:@[] withStates:@{}];
+    
+    [self object:chat shouldNotHandleEvent:@"$.offline.leave" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        chat.fetchUserUpdates();
+        [chat handleRemoteUsersJoin:@[user] withStates:@{} onStateChange:NO];
+        [chat handleRemoteUsersRefresh:@[] withStates:@{}];
+    }];
+    
+    XCTAssertNotNil(chat.users[user.uuid]);
+}
+
+- (void)testHandlePresenceEvent_ShouldNotEmitOnlineHere_WhenRefreshedUsersListNotChanged {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    NSDictionary *state = @{ @"test": @"value" };
+    
+    
+    [chat handleRemoteUsersRefresh:@[user] withStates:@{ user.uuid: state }];
+    
+    CENEventHandlerBlock (^handlerBlock)(dispatch_block_t) = ^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    };
+    
+    [self object:chat shouldNotHandleEvents:@[@"$.online.here", @"$.state"] withinInterval:self.testCompletionDelay
+    withHandlers:@[handlerBlock, handlerBlock] afterBlock:^{
+        [chat handleRemoteUsersRefresh:@[user] withStates:@{ user.uuid: state }];
+    }];
+}
+
 - (void)testHandlePresenceEvent_ShouldEmitOnlineJoin_WhenUserJoinToChat {
     
     NSString *expectedUserUUID = @"test-user";
@@ -1009,6 +1226,131 @@
     }];
 }
 
+- (void)testHandlePresenceEvent_ShouldEmitSingleOnlineBatch_WhenPresenceChangesHandledAtOnce {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user1 = [CENUser userWithUUID:@"test-user1" state:@{} chatEngine:self.client];
+    CENUser *user2 = [CENUser userWithUUID:@"test-user2" state:@{} chatEngine:self.client];
+    CENUser *user3 = [CENUser userWithUUID:@"test-user3" state:@{} chatEngine:self.client];
+    
+    
+    [chat handleRemoteUsersJoin:@[user1] withStates:@{} onStateChange:NO];
+    
+    [self object:chat shouldHandleEvent:@"$.online.batch" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            NSDictionary *changes = emittedEvent.data;
+            
+            XCTAssertEqualObjects(changes[CENPresenceBatch.join], (@[user2, user3]));
+            XCTAssertEqualObjects(changes[CENPresenceBatch.leave], @[user1]);
+            XCTAssertEqual(((NSArray *)changes[CENPresenceBatch.disconnect]).count, 0);
+            XCTAssertEqual(((NSArray *)changes[CENPresenceBatch.state]).count, 0);
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersJoin:@[user2, user3] leave:@[user1] disconnect:nil stateChange:nil withStates:@{}];
+    }];
+}
+
+- (void)testHandlePresenceEvent_ShouldNotEmitPerUserEvents_WhenPresenceChangesHandledAtOnce {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    
+    
+    [self object:chat shouldNotHandleEvent:@"$.online.join" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersJoin:@[user] leave:nil disconnect:nil stateChange:nil withStates:@{}];
+    }];
+}
+
+- (void)testHandlePresenceEvent_ShouldNotEmitOnlineBatch_WhenPresenceChangesDoesNotChangeParticipants {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    CENUser *user = [CENUser userWithUUID:@"test-user" state:@{} chatEngine:self.client];
+    
+    
+    [self object:chat shouldNotHandleEvent:@"$.online.batch" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteUsersJoin:nil leave:@[user] disconnect:nil stateChange:nil withStates:@{}];
+    }];
+}
+
+- (void)testHandlePresenceEvent_ShouldEmitOccupancy_WhenOccupancyChanged {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    NSUInteger expectedOccupancy = 20000;
+    
+    
+    [self object:chat shouldHandleEvent:@"$.occupancy" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            XCTAssertEqualObjects(emittedEvent.data, @(expectedOccupancy));
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteOccupancyChange:expectedOccupancy];
+    }];
+    
+    XCTAssertEqual(chat.occupancy, expectedOccupancy);
+    XCTAssertEqual(chat.users.count, 0);
+}
+
+- (void)testHandlePresenceEvent_ShouldNotEmitOccupancy_WhenOccupancyNotChanged {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    NSUInteger occupancy = 20000;
+    
+    
+    [self object:chat shouldHandleEvent:@"$.occupancy" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteOccupancyChange:occupancy];
+    }];
+    
+    [self object:chat shouldNotHandleEvent:@"$.occupancy" withHandler:^CENEventHandlerBlock (dispatch_block_t handler) {
+        return ^(CENEmittedEvent *emittedEvent) {
+            handler();
+        };
+    } afterBlock:^{
+        [chat handleRemoteOccupancyChange:occupancy];
+    }];
+}
+
+- (void)testHandlePresenceEvent_ShouldNotRefreshOccupancy_WhenChangedAfterOccupancyRequest {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    NSUInteger expectedOccupancy = 20000;
+    
+    
+    [chat handleRemoteOccupancyChange:expectedOccupancy];
+    [chat handleRemoteOccupancyRefresh:(expectedOccupancy - 1)];
+    
+    XCTAssertEqual(chat.occupancy, expectedOccupancy);
+}
+
+- (void)testHandlePresenceEvent_ShouldRefreshOccupancy_WhenManuallyRequestedAfterPresenceChange {
+    
+    CENChat *chat = [self privateCustomChat:NO withName:self.chatName meta:self.publicChatMeta];
+    NSUInteger expectedOccupancy = 20000;
+    
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    
+    OCMStub([self.client fetchParticipantsForChat:chat]);
+    [chat handleRemoteOccupancyChange:(expectedOccupancy - 1)];
+    chat.fetchUserUpdates();
+    [chat handleRemoteOccupancyRefresh:expectedOccupancy];
+    
+    XCTAssertEqual(chat.occupancy, expectedOccupancy);
+}
+
 
 #pragma mark - Tests :: connect / connectChat
 
@@ -1456,7 +1798,8 @@
                     meta:(NSDictionary *)meta {
     
     CENChat *chat = [CENChat chatWithName:name namespace:self.chatNamespace group:group private:isPrivate
-                                 metaData:meta chatEngine:self.client];
+                                 metaData:meta participantsPolicy:CENChatParticipantsUsers
+                               chatEngine:self.client];
     
     if (chat) {
         [self.chats addObject:chat];
@@ -37,7 +37,8 @@
 
 - (BOOL)hasMockedObjectsInTestCaseWithName:(NSString *)name {
     
-    return [name rangeOfString:@"testDestruct_ShouldUnregisterObjectByClient"].location != NSNotFound;
+    return ([name rangeOfString:@"testDestruct_ShouldUnregisterObjectByClient"].location != NSNotFound ||
+            [name rangeOfString:@"WhenClientHasNoHandlersForEvent"].location != NSNotFound);
 }
 
 - (BOOL)shouldSetupVCR {
@@ -114,6 +115,20 @@
     }];
 }
 
+- (void)testEmitEventLocally_ShouldNotEmitEventFromChatEngineClient_WhenClientHasNoHandlersForEvent {
+    
+    CENObject *object = [[CENObject alloc] initWithChatEngine:self.client];
+    
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    
+    OCMExpect([[(id)self.client reject] emitEventLocally:@"test-event" withParameters:[OCMArg any]]);
+    
+    [object emitEventLocally:@"test-event", nil];
+    
+    OCMVerifyAll((id)self.client);
+}
+
 
 #pragma mark - Tests :: onCreate
 
@@ -9,6 +9,7 @@
 #import <CENChatEngine/ChatEngine.h>
 #import <OCMock/OCMock.h>
 #import "CENTestCase.h"
+#import <mach/mach.h>
 
 
 @interface CENUserTest : CENTestCase
@@ -20,6 +21,16 @@
 @property (nonatomic, nullable, strong) NSDictionary *changedState;
 @property (nonatomic, nullable, strong) NSString *defaultUUID;
 
+
+#pragma mark - Misc
+
+/**
+ * @brief Retrieve amount of memory which is currently used by test process.
+ *
+ * @return Resident memory size in bytes.
+ */
+- (uint64_t)residentMemorySize;
+
 #pragma mark -
 
 
@@ -92,6 +103,78 @@
     XCTAssertNil(user);
 }
 
+- (void)testConstructor_ShouldNotCreateDirectAndFeedChats_WhenRemoteUserCreated {
+    
+    self.usesMockedObjects = YES;
+    
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    
+    OCMExpect([[(id)self.client reject] createDirectChatForUser:[OCMArg any]]);
+    OCMExpect([[(id)self.client reject] createFeedChatForUser:[OCMArg any]]);
+    
+    CENUser *user = [CENUser userWithUUID:self.defaultUUID state:self.defaultState chatEngine:self.client];
+    
+    XCTAssertNotNil(user);
+    OCMVerifyAll((id)self.client);
+}
+
+
+#pragma mark - Tests :: direct / feed
+
+- (void)testDirect_ShouldCreateChatOnce_WhenAccessedFirstTime {
+    
+    CENUser *user = [CENUser userWithUUID:self.defaultUUID state:self.defaultState chatEngine:self.client];
+    
+    
+    CENChat *direct = user.direct;
+    
+    XCTAssertNotNil(direct);
+    XCTAssertEqual(user.direct, direct);
+    XCTAssertNotEqual([direct.channel rangeOfString:@"direct"].location, NSNotFound);
+}
+
+- (void)testFeed_ShouldCreateChatOnce_WhenAccessedFirstTime {
+    
+    CENUser *user = [CENUser userWithUUID:self.defaultUUID state:self.defaultState chatEngine:self.client];
+    
+    
+    CENChat *feed = user.feed;
+    
+    XCTAssertNotNil(feed);
+    XCTAssertEqual(user.feed, feed);
+    XCTAssertNotEqual([feed.channel rangeOfString:@"feed"].location, NSNotFound);
+}
+
+- (void)testRemoteUserMemoryFootprint_ShouldBeLower_WhenDirectAndFeedChatsNotCreated {
+    
+    NSMutableArray<CENUser *> *users = [NSMutableArray new];
+    NSUInteger usersCount = 2000;
+    
+    
+    uint64_t initialMemorySize = [self residentMemorySize];
+    
+    for (NSUInteger idx = 0; idx < usersCount; idx++) {
+        NSString *uuid = [@"lazy-" stringByAppendingString:@(idx).stringValue];
+        
+        [users addObject:[CENUser userWithUUID:uuid state:nil chatEngine:self.client]];
+    }
+    
+    uint64_t lazyMemorySize = [self residentMemorySize];
+    
+    for (CENUser *user in users) {
+        [user direct];
+        [user feed];
+    }
+    
+    uint64_t eagerMemorySize = [self residentMemorySize];
+    uint64_t lazyBytesPerUser = (lazyMemorySize - MIN(initialMemorySize, lazyMemorySize)) / usersCount;
+    uint64_t eagerBytesPerUser = (eagerMemorySize - MIN(initialMemorySize, eagerMemorySize)) / usersCount;
+    
+    XCTAssertEqual(users.count, usersCount);
+    XCTAssertLessThan(lazyBytesPerUser, eagerBytesPerUser);
+}
+
 
 #pragma mark - Tests :: assignState
 
@@ -256,6 +339,82 @@
     OCMVerifyAll((id)self.client);
 }
 
+- (void)testFetchStoredStateWithCompletion_ShouldRequestStateOnce_WhenCalledWhileFetchInProgress {
+    
+    self.usesMockedObjects = YES;
+    NSDictionary *nilState = nil;
+    CENUser *user = [CENUser userWithUUID:@"stateTester" state:nilState chatEngine:self.client];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    __block NSUInteger fetchesCount = 0;
+    __block NSUInteger completionsCount = 0;
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    OCMStub([self.client global]).andReturn(chat);
+
+    OCMStub([self.client fetchUserState:user forChat:chat withCompletion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            void(^handlerBlock)(NSDictionary *) = [self objectForInvocation:invocation argumentAtIndex:3];
+            fetchesCount++;
+            
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.delayedCheck * NSEC_PER_SEC)),
+                           dispatch_get_main_queue(), ^{
+                handlerBlock(self.defaultState);
+            });
+        });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        for (NSUInteger callIdx = 0; callIdx < 5; callIdx++) {
+            [user restoreStateForChat:self.client.global withCompletion:^(NSDictionary *state) {
+                XCTAssertEqualObjects(state, self.defaultState);
+                
+                if (++completionsCount == 5) {
+                    handler();
+                }
+            }];
+        }
+    }];
+    
+    XCTAssertEqual(fetchesCount, 1);
+}
+
+- (void)testFetchStoredStateWithCompletion_ShouldRequestStateAgain_WhenPreviousFetchDidFail {
+    
+    self.usesMockedObjects = YES;
+    NSDictionary *nilState = nil;
+    CENUser *user = [CENUser userWithUUID:@"stateTester" state:nilState chatEngine:self.client];
+    CENChat *chat = [self publicChatWithChatEngine:self.client];
+    __block NSUInteger fetchesCount = 0;
+
+
+    XCTAssertTrue([self isObjectMocked:self.client]);
+
+    OCMStub([self.client global]).andReturn(chat);
+
+    OCMStub([self.client fetchUserState:user forChat:chat withCompletion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            void(^handlerBlock)(NSDictionary *) = [self objectForInvocation:invocation argumentAtIndex:3];
+            handlerBlock(++fetchesCount > 1 ? self.defaultState : nil);
+        });
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [user restoreStateForChat:self.client.global withCompletion:^(NSDictionary *state) {
+            XCTAssertNil(state);
+            handler();
+        }];
+    }];
+    
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [user restoreStateForChat:self.client.global withCompletion:^(NSDictionary *state) {
+            XCTAssertEqualObjects(state, self.defaultState);
+            handler();
+        }];
+    }];
+    
+    XCTAssertEqual(fetchesCount, 2);
+}
+
 
 #pragma mark - Tests :: state
 
@@ -378,6 +537,18 @@
     XCTAssertNotEqual([description rangeOfString:@"state set: 0 chats"].location, NSNotFound);
 }
 
+
+#pragma mark - Misc
+
+- (uint64_t)residentMemorySize {
+    
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    kern_return_t result = task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count);
+    
+    return result == KERN_SUCCESS ? info.resident_size : 0;
+}
+
 #pragma mark -
 
 
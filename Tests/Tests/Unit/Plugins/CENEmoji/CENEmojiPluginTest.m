@@ -90,11 +90,12 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENEmojiConfiguration.events: @[@"custom"] };
-    [CENEmojiPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENEmojiPlugin *plugin = [CENEmojiPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *onEvents = CENEmojiOnMiddleware.events;
-    NSArray<NSString *> *emitEvents = CENEmojiOnMiddleware.events;
+    NSArray<NSString *> *onEvents = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.on object:chat];
+    NSArray<NSString *> *emitEvents = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.emit object:chat];
     
     XCTAssertEqual(onEvents.count, 1);
     XCTAssertTrue([onEvents containsObject:@"custom"]);
@@ -93,6 +93,28 @@
     }];
 }
 
+- (void)testEventSent_ShouldNotifyChatFromPayload_WhenSharedMiddlewareUsed {
+    
+    NSDictionary *eventStatusData = @{ CENEventStatusData.identifier: [NSUUID UUID].UUIDString };
+    NSMutableDictionary *payload = [@{
+        CENEventStatusData.data: eventStatusData,
+        CENEventData.chat: self.chat
+    } mutableCopy];
+    NSDictionary *expectedPayload = @{ CENEventData.data: eventStatusData };
+    
+    
+    self.middleware = [CENEventStatusOnMiddleware sharedMiddlewareWithIdentifier:@"test" configuration:nil
+                                                                          events:nil];
+    
+    XCTAssertTrue([self isObjectMocked:self.client]);
+    
+    id recorded = OCMExpect([self.client triggerEventLocallyFrom:self.chat event:@"$.eventStatus.sent"
+                                                  withParameters:@[expectedPayload] completion:[OCMArg any]]);
+    [self waitForObject:self.client recordedInvocationCall:recorded afterBlock:^{
+        [self.middleware runForEvent:@"$.emitted" withData:payload completion:^(BOOL rejected) { }];
+    }];
+}
+
 - (void)testEventSent_ShouldNotNotifyOnEventEmit_WhenEventStatusDataIsMissing {
     
     NSMutableDictionary *payload = [@{ } mutableCopy];
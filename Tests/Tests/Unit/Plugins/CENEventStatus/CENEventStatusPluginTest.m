@@ -54,6 +54,11 @@
     XCTAssertEqualObjects(CENEventStatusPlugin.identifier, @"com.chatengine.plugin.event-status");
 }
 
+- (void)testSharesEventMiddlewares_ShouldBeEnabled {
+    
+    XCTAssertTrue([CENEventStatusPlugin sharesEventMiddlewares]);
+}
+
 
 #pragma mark - Tests :: Configuration
 
@@ -83,11 +88,12 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENEventStatusConfiguration.events: @[@"custom"] };
-    [CENEventStatusPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENEventStatusPlugin *plugin = [CENEventStatusPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *emitEvents = CENEventStatusEmitMiddleware.events;
-    NSArray<NSString *> *onEvents = CENEventStatusOnMiddleware.events;
+    NSArray<NSString *> *emitEvents = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.emit object:chat];
+    NSArray<NSString *> *onEvents = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.on object:chat];
     
     XCTAssertEqual(onEvents.count, 2);
     XCTAssertTrue([onEvents containsObject:@"custom"]);
@@ -80,10 +80,11 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENMarkdownConfiguration.events: @[@"custom"] };
-    [CENMarkdownPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENMarkdownPlugin *plugin = [CENMarkdownPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *events = CENMarkdownMiddleware.events;
+    NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.on object:chat];
     
     XCTAssertEqual(events.count, 1);
     XCTAssertTrue([events containsObject:@"custom"]);
@@ -82,10 +82,11 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENMuterConfiguration.events: @[@"custom"] };
-    [CENMuterPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENMuterPlugin *plugin = [CENMuterPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *events = CENMuterMiddleware.events;
+    NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.on object:chat];
     
     XCTAssertEqual(events.count, 1);
     XCTAssertTrue([events containsObject:@"custom"]);
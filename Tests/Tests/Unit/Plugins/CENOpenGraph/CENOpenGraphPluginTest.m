@@ -80,10 +80,11 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENOpenGraphConfiguration.events: @[@"custom"] };
-    [CENOpenGraphPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENOpenGraphPlugin *plugin = [CENOpenGraphPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *events = CENOpenGraphMiddleware.events;
+    NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.on object:chat];
     
     XCTAssertEqual(events.count, 1);
     XCTAssertTrue([events containsObject:@"custom"]);
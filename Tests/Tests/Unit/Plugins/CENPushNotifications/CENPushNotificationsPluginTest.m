@@ -100,10 +100,11 @@
 - (void)testConfiguration_ShouldReplaceMiddlewareDefaultEvents_WhenConfigurationWithEventsPassed {
     
     NSDictionary *configuration = @{ CENPushNotificationsConfiguration.events: @[@"custom"] };
-    [CENPushNotificationsPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENPushNotificationsPlugin *plugin = [CENPushNotificationsPlugin pluginWithIdentifier:@"test" configuration:configuration];
+    CENChat *chat = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
     
     
-    NSArray<NSString *> *events = CENPushNotificationsMiddleware.events;
+    NSArray<NSString *> *events = [plugin eventsForMiddlewareLocation:CEPMiddlewareLocation.emit object:chat];
     
     XCTAssertEqual(events.count, 2);
     XCTAssertTrue([events containsObject:@"custom"]);
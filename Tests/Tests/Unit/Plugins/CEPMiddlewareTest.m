@@ -7,12 +7,28 @@
 #import "CENTestCase.h"
 
 
-@interface CEPMiddleware (ProtectedTest)
+#pragma mark Test middleware
 
-#pragma mark - Information
+@interface CEPMiddlewareTestMiddleware : CEPMiddleware
 
-@property (nonatomic, strong) NSMutableArray<NSString *> *ignoredEvents;
-@property (nonatomic, strong) NSMutableArray<NSString *> *checkedEvents;
+
+#pragma mark -
+
+
+@end
+
+
+@implementation CEPMiddlewareTestMiddleware
+
++ (NSString *)location {
+    
+    return CEPMiddlewareLocation.on;
+}
+
++ (NSArray<NSString *> *)events {
+    
+    return @[@"test.event.*", @"test-event-4"];
+}
 
 #pragma mark -
 
@@ -65,6 +81,8 @@
     XCTAssertThrows([CEPMiddleware events]);
 }
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
 - (void)testReplaceEventsWith_ShouldNotThrowException_WhenAccessedEvents {
     
     [CEPMiddleware replaceEventsWith:@[]];
@@ -81,6 +99,7 @@
     
     XCTAssertEqualObjects([CEPMiddleware events], expected);
 }
+#pragma clang diagnostic pop
 
 
 #pragma mark - Tests :: Constructor
@@ -161,6 +180,30 @@
     XCTAssertNil([CEPMiddleware middlewareForObject:user withIdentifier:identifier configuration:nil]);
 }
 
+- (void)testConstructor_ShouldUseClassEvents_WhenEventsNotPassed {
+
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    
+    
+    CEPMiddleware *middleware = [CEPMiddlewareTestMiddleware middlewareForObject:user withIdentifier:@"test"
+                                                                   configuration:nil events:nil];
+    
+    XCTAssertEqualObjects(middleware.events, CEPMiddlewareTestMiddleware.events);
+}
+
+- (void)testConstructor_ShouldUsePassedEvents_WhenEventsPassed {
+
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    NSArray *expected = @[@"custom"];
+    
+    
+    CEPMiddleware *middleware = [CEPMiddlewareTestMiddleware middlewareForObject:user withIdentifier:@"test"
+                                                                   configuration:nil events:expected];
+    
+    XCTAssertEqualObjects(middleware.events, expected);
+    XCTAssertEqualObjects(CEPMiddlewareTestMiddleware.events, (@[@"test.event.*", @"test-event-4"]));
+}
+
 - (void)testConstructor_ShouldSetEmptyDictionaryConfiguration_WhenNonNSDictionaryPassed {
 
     CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
@@ -326,6 +369,20 @@
     XCTAssertFalse([middleware registeredForEvent:@"test.event.5"]);
 }
 
+- (void)testRegisteredForEvent_ShouldReturnYESForEventPathEvent_WhenEventNameCaseDifferentFromClassEvents {
+
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    NSArray *events = @[@"test.event.*"];
+    
+    
+    id classMock = [self mockForObject:[CEPMiddleware class]];
+    OCMStub([classMock events]).andReturn(events);
+    
+    CEPMiddleware *middleware = [CEPMiddleware middlewareForObject:user withIdentifier:@"test" configuration:nil];
+    
+    XCTAssertTrue([middleware registeredForEvent:@"Test.Event.8"]);
+}
+
 - (void)testRegisteredForEvent_ShouldStoreMatchResultsOnce_WhenCalledFewTimesForSameEvent {
 
     CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
@@ -339,10 +396,12 @@
     [middleware registeredForEvent:@"test-event-4"];
     [middleware registeredForEvent:@"test-event-4"];
     
-    XCTAssertEqual(middleware.checkedEvents.count, 1);
+    XCTAssertEqual(middleware.matchCacheSize, 1);
+    XCTAssertEqual(middleware.matchCacheMisses, 1);
+    XCTAssertEqual(middleware.matchCacheHits, 1);
 }
 
-- (void)testRegisteredForEvent_ShouldStoreInIgnoredEvents_WhenEventNotInClassEvents {
+- (void)testRegisteredForEvent_ShouldStoreMatchResult_WhenEventNotInClassEvents {
 
     CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
     NSArray *events = @[@"test-event-3", @"test-event-4"];
@@ -354,8 +413,70 @@
     CEPMiddleware *middleware = [CEPMiddleware middlewareForObject:user withIdentifier:@"test" configuration:nil];
     [middleware registeredForEvent:@"test-event-5"];
     
-    XCTAssertEqual(middleware.checkedEvents.count, 1);
-    XCTAssertEqual(middleware.ignoredEvents.count, 1);
+    XCTAssertFalse([middleware registeredForEvent:@"test-event-5"]);
+    XCTAssertEqual(middleware.matchCacheSize, 1);
+    XCTAssertEqual(middleware.matchCacheHits, 1);
+}
+
+- (void)testRegisteredForEvent_ShouldUseInstanceEvents_WhenEventsPassedDuringCreation {
+
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    
+    
+    CEPMiddleware *middleware = [CEPMiddlewareTestMiddleware middlewareForObject:user withIdentifier:@"test"
+                                                                   configuration:nil
+                                                                          events:@[@"custom.*"]];
+    
+    XCTAssertTrue([middleware registeredForEvent:@"custom.event"]);
+    XCTAssertFalse([middleware registeredForEvent:@"test.event.1"]);
+    XCTAssertFalse([middleware registeredForEvent:@"test-event-4"]);
+}
+
+- (void)testRegisteredForEvent_ShouldMatchEventsIndependently_WhenInstancesCreatedWithDifferentEvents {
+
+    CENChat *chat1 = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
+    CENChat *chat2 = self.client.Chat().name([NSUUID UUID].UUIDString).autoConnect(NO).create();
+    
+    
+    CEPMiddleware *middleware1 = [CEPMiddlewareTestMiddleware middlewareForObject:chat1 withIdentifier:@"test"
+                                                                    configuration:nil
+                                                                           events:@[@"message"]];
+    CEPMiddleware *middleware2 = [CEPMiddlewareTestMiddleware middlewareForObject:chat2 withIdentifier:@"test"
+                                                                    configuration:nil
+                                                                           events:@[@"$typing.**"]];
+    
+    XCTAssertTrue([middleware1 registeredForEvent:@"message"]);
+    XCTAssertFalse([middleware1 registeredForEvent:@"$typing.start"]);
+    XCTAssertFalse([middleware2 registeredForEvent:@"message"]);
+    XCTAssertTrue([middleware2 registeredForEvent:@"$typing.start"]);
+}
+
+- (void)testRegisteredForEvent_ShouldKeepMatchCacheBounded_WhenCalledForMillionDistinctEvents {
+
+    CENUser *user = self.client.User([NSUUID UUID].UUIDString).create();
+    NSUInteger eventsCount = 1000000;
+    NSUInteger cacheSizeLimit = 0;
+    
+    
+    CEPMiddleware *middleware = [CEPMiddlewareTestMiddleware middlewareForObject:user withIdentifier:@"test"
+                                                                   configuration:nil];
+    
+    for (NSUInteger eventIdx = 0; eventIdx < eventsCount; eventIdx++) {
+        @autoreleasepool {
+            [middleware registeredForEvent:[NSString stringWithFormat:@"test.event.%@", @(eventIdx)]];
+        }
+        
+        if (eventIdx == eventsCount / 2) {
+            cacheSizeLimit = middleware.matchCacheSize;
+        }
+    }
+    
+    XCTAssertGreaterThan(cacheSizeLimit, 0);
+    XCTAssertEqual(middleware.matchCacheSize, cacheSizeLimit);
+    XCTAssertEqual(middleware.matchCacheMisses, eventsCount);
+    XCTAssertEqual(middleware.matchCacheEvictions, eventsCount - cacheSizeLimit);
+    XCTAssertTrue([middleware registeredForEvent:@"test.event.999999"]);
+    XCTAssertEqual(middleware.matchCacheHits, 1);
 }
 
 